@@ -0,0 +1,180 @@
+#define _GNU_SOURCE
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static long long read_misses (const bench__Suite * suite) {
+#ifdef __linux__
+    long long count = 0;
+    if (suite->perf_fd >= 0 && read(suite->perf_fd, &count, sizeof(count)) == sizeof(count)) {
+        return count;
+    }
+#else
+    (void) suite;
+#endif
+    return -1;
+}
+
+static void reset_peak_rss (void) {
+#ifdef __linux__
+    // since Linux 4.0, writing 5 to clear_refs resets VmHWM
+    FILE * fp = fopen("/proc/self/clear_refs", "w");
+    if (fp != NULL) {
+        fputs("5", fp);
+        fclose(fp);
+    }
+#endif
+}
+
+static long read_peak_rss_kib (void) {
+#ifdef __linux__
+    FILE * fp = fopen("/proc/self/status", "r");
+    if (fp != NULL) {
+        char line[256];
+        long kib = -1;
+        while (fgets(line, sizeof(line), fp) != NULL) {
+            if (sscanf(line, "VmHWM: %ld kB", &kib) == 1) break;
+        }
+        fclose(fp);
+        if (kib >= 0) return kib;
+    }
+#endif
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+double bench__now (void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+void bench__begin (bench__Suite * suite) {
+    reset_peak_rss();
+    suite->elapsed = 0.0;
+    suite->misses = 0;
+    suite->hit_rate = -1.0;
+    bench__resume(suite);
+}
+
+void bench__end (bench__Suite * suite, const char * name, const char * variant, size_t n, size_t nops) {
+    bench__pause(suite);
+    double ns_per_op = suite->elapsed / (double) nops;
+    char misses[32] = "null";
+    if (suite->perf_fd >= 0) {
+        snprintf(misses, sizeof(misses), "%.3f", (double) suite->misses / (double) nops);
+    }
+    char hit_rate[32] = "null";
+    if (suite->hit_rate >= 0.0) {
+        snprintf(hit_rate, sizeof(hit_rate), "%.4f", suite->hit_rate);
+    }
+    long rss = read_peak_rss_kib();
+    fprintf(suite->fd,
+            "%s\n    {\"name\": \"%s\", \"variant\": \"%s\", \"n\": %zu, \"nops\": %zu, \"ns_per_op\": %.3f, "
+            "\"cache_misses_per_op\": %s, \"peak_rss_kib\": %ld, \"hit_rate\": %s}",
+            suite->nresults == 0 ? "" : ",", name, variant, n, nops, ns_per_op, misses, rss, hit_rate);
+    fflush(suite->fd);
+    fprintf(stderr, "%-24s %-28s n = %9zu  %12.2f ns/op  %10s misses/op  %8ld KiB", name, variant, n, ns_per_op,
+            misses, rss);
+    if (suite->hit_rate >= 0.0) {
+        fprintf(stderr, "  %6.2f%% hits", 100.0 * suite->hit_rate);
+    }
+    fprintf(stderr, "\n");
+    suite->nresults++;
+}
+
+void bench__hit_rate (bench__Suite * suite, double hit_rate) {
+    suite->hit_rate = hit_rate;
+}
+
+void bench__pause (bench__Suite * suite) {
+    double t1 = bench__now();
+    long long misses1 = read_misses(suite);
+    suite->elapsed += t1 - suite->t0;
+    suite->misses += misses1 - suite->misses0;
+}
+
+void bench__resume (bench__Suite * suite) {
+    suite->misses0 = read_misses(suite);
+    suite->t0 = bench__now();
+}
+
+size_t bench__reps (size_t n) {
+    return n >= 1000000 ? 1 : 1000000 / n;
+}
+
+bench__Payloads bench__payloads_create (size_t n, bool shuffled) {
+    bench__Payloads payloads = {
+        .values = malloc(sizeof(int) * n),
+        .items = malloc(sizeof(void *) * n)
+    };
+    if (payloads.values == NULL || payloads.items == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for benchmark payloads.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < n; i++) {
+        payloads.values[i] = (int) i;
+        payloads.items[i] = &payloads.values[i];
+    }
+    if (shuffled) {
+        unsigned long long seed = 12345;
+        for (size_t i = n; i > 1; i--) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            size_t j = (size_t) (seed >> 33) % i;
+            void * tmp = payloads.items[i - 1];
+            payloads.items[i - 1] = payloads.items[j];
+            payloads.items[j] = tmp;
+        }
+    }
+    return payloads;
+}
+
+void bench__payloads_destroy (bench__Payloads * payloads) {
+    free(payloads->values);
+    free(payloads->items);
+    payloads->values = NULL;
+    payloads->items = NULL;
+}
+
+void bench__suite_init (bench__Suite * suite, FILE * fd, size_t maxsize) {
+    suite->fd = fd;
+    suite->maxsize = maxsize;
+    suite->nresults = 0;
+    suite->perf_fd = -1;
+    suite->hit_rate = -1.0;
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.inherit = 1;
+    suite->perf_fd = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    fprintf(fd, "{\n  \"max_size\": %zu,\n  \"cache_misses_available\": %s,\n  \"results\": [", maxsize,
+            suite->perf_fd >= 0 ? "true" : "false");
+}
+
+void bench__suite_fini (bench__Suite * suite) {
+    fprintf(suite->fd, "\n  ]\n}\n");
+#ifdef __linux__
+    if (suite->perf_fd >= 0) {
+        close(suite->perf_fd);
+    }
+#endif
+}
@@ -0,0 +1,131 @@
+#ifndef BENCH_H
+#define BENCH_H
+#include <stdio.h>
+
+/**
+ * @brief  State shared by all benchmarks in a run: where results go,
+ *         how large lists may get, and the measurement in progress.
+ */
+typedef struct {
+    FILE * fd;
+    size_t maxsize;
+    size_t nresults;
+    int perf_fd;
+    double elapsed;
+    long long misses;
+    double t0;
+    long long misses0;
+    double hit_rate;
+} bench__Suite;
+
+/**
+ * @brief  Payload items for a benchmark. items[i] points into values,
+ *         either in memory order or in a shuffled order.
+ */
+typedef struct {
+    int * values;
+    void ** items;
+} bench__Payloads;
+
+/**
+ * @brief   Get the current time
+ * @returns A monotonic timestamp in nanoseconds.
+ */
+double bench__now (void);
+
+/**
+ * @brief   Start measuring. Resets the peak RSS where the platform
+ *          allows it.
+ */
+void bench__begin (bench__Suite * suite);
+
+/**
+ * @brief   Stop measuring and write the result as a JSON object.
+ * @param n     The size of the list that was operated on.
+ * @param nops  The number of operations that were timed.
+ */
+void bench__end (bench__Suite * suite, const char * name, const char * variant, size_t n, size_t nops);
+
+/**
+ * @brief   Attach a cache hit rate between 0 and 1 to the result that
+ *          the next ::bench__end writes. Other results report `null`.
+ */
+void bench__hit_rate (bench__Suite * suite, double hit_rate);
+
+/**
+ * @brief   Exclude what follows from the measurement, e.g. setup.
+ */
+void bench__pause (bench__Suite * suite);
+
+/**
+ * @brief   Continue measuring after ::bench__pause.
+ */
+void bench__resume (bench__Suite * suite);
+
+/**
+ * @brief   Number of repetitions that makes a benchmark on a list of n
+ *          items process roughly a million items in total.
+ */
+size_t bench__reps (size_t n);
+
+bench__Payloads bench__payloads_create (size_t n, bool shuffled);
+
+void bench__payloads_destroy (bench__Payloads * payloads);
+
+void bench__suite_init (bench__Suite * suite, FILE * fd, size_t maxsize);
+
+void bench__suite_fini (bench__Suite * suite);
+
+void bench_allist__delete (bench__Suite * suite);
+
+void bench_cllist__queue (bench__Suite * suite);
+
+void bench_illist__append (bench__Suite * suite);
+
+void bench_llist__append (bench__Suite * suite);
+
+void bench_llist__append_array (bench__Suite * suite);
+
+void bench_llist__compact (bench__Suite * suite);
+
+void bench_llist__create (bench__Suite * suite);
+
+void bench_llist__delete (bench__Suite * suite);
+
+void bench_llist__delete_key (bench__Suite * suite);
+
+void bench_llist__delete_where (bench__Suite * suite);
+
+void bench_llist__destroy (bench__Suite * suite);
+
+void bench_llist__insert (bench__Suite * suite);
+
+void bench_llist__iter_next (bench__Suite * suite);
+
+void bench_llist__load_mmap (bench__Suite * suite);
+
+void bench_llist__lru (bench__Suite * suite);
+
+void bench_llist__parallel_filter (bench__Suite * suite);
+
+void bench_llist__pool (bench__Suite * suite);
+
+void bench_llist__prepend (bench__Suite * suite);
+
+void bench_llist__reserve (bench__Suite * suite);
+
+void bench_llist__set_indexed (bench__Suite * suite);
+
+void bench_llist__set_prefetch (bench__Suite * suite);
+
+void bench_llist__sort (bench__Suite * suite);
+
+void bench_llist__write (bench__Suite * suite);
+
+void bench_pllist__snapshot (bench__Suite * suite);
+
+void bench_tllist__for_each (bench__Suite * suite);
+
+void bench_ullist__delete (bench__Suite * suite);
+
+#endif
@@ -0,0 +1,47 @@
+#include "bench.h"
+#include "llist/allist.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static bool keep (void *) {
+    return false;
+}
+
+void bench_allist__delete (bench__Suite * suite) {
+    // full scans of a LinkedList versus an ArrayLinkedList holding the
+    // same items; the scan is a global delete whose filter never matches.
+    // Both lists are built by randomly prepending or appending, so that
+    // neither walks its memory in address order
+    static int item = 0;
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+
+        LinkedList * lst = llist__create();
+        ArrayLinkedList * alst = allist__create(n);
+        size_t state = 1;
+        for (size_t i = 0; i < n; i++) {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            if ((state >> 33) & 1) {
+                llist__prepend(lst, (void *) &item);
+                allist__prepend(alst, (void *) &item);
+            } else {
+                llist__append(lst, (void *) &item);
+                allist__append(alst, (void *) &item);
+            }
+        }
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            llist__delete(true, lst, keep);
+        }
+        bench__end(suite, "allist__delete", "LinkedList scan", n, n * nreps);
+        llist__destroy(&lst);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            allist__delete(true, alst, keep);
+        }
+        bench__end(suite, "allist__delete", "default", n, n * nreps);
+        allist__destroy(&alst);
+    }
+}
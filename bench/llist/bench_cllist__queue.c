@@ -0,0 +1,81 @@
+#include "bench.h"
+#include "llist/cllist.h"
+#include "llist/llist.h"
+#include <stdio.h>
+#include <threads.h>
+
+#define NOPS_PER_THREAD 200000
+
+static ConcurrentQueue * q = NULL;
+
+static ConcurrentStack * s = NULL;
+
+static LinkedList * lst = NULL;
+
+static mtx_t lock;
+
+static int item = 0;
+
+static int work_queue (void *) {
+    for (size_t i = 0; i < NOPS_PER_THREAD; i++) {
+        void * p = NULL;
+        cllist__queue_append(q, (void *) &item);
+        cllist__queue_pop_front(q, &p);
+    }
+    return 0;
+}
+
+static int work_stack (void *) {
+    for (size_t i = 0; i < NOPS_PER_THREAD; i++) {
+        void * p = NULL;
+        cllist__stack_push(s, (void *) &item);
+        cllist__stack_pop(s, &p);
+    }
+    return 0;
+}
+
+static int work_mutex (void *) {
+    for (size_t i = 0; i < NOPS_PER_THREAD; i++) {
+        mtx_lock(&lock);
+        llist__append(lst, (void *) &item);
+        mtx_unlock(&lock);
+        mtx_lock(&lock);
+        if (llist__get_length(lst) > 0) {
+            llist__pop_front(lst);
+        }
+        mtx_unlock(&lock);
+    }
+    return 0;
+}
+
+static void run (bench__Suite * suite, const char * name, size_t nthreads, int (*work)(void *)) {
+    thrd_t threads[64];
+    char variant[32];
+    snprintf(variant, sizeof(variant), "threads=%zu", nthreads);
+    bench__begin(suite);
+    for (size_t t = 0; t < nthreads; t++) {
+        thrd_create(&threads[t], work, NULL);
+    }
+    for (size_t t = 0; t < nthreads; t++) {
+        thrd_join(threads[t], NULL);
+    }
+    bench__end(suite, name, variant, 0, 2 * NOPS_PER_THREAD * nthreads);
+}
+
+void bench_cllist__queue (bench__Suite * suite) {
+    // aggregate throughput of append/pop pairs as the number of threads
+    // grows, against a LinkedList behind a mutex
+    q = cllist__queue_create();
+    s = cllist__stack_create();
+    lst = llist__create();
+    mtx_init(&lock, mtx_plain);
+    for (size_t nthreads = 1; nthreads <= 16; nthreads *= 2) {
+        run(suite, "cllist__queue", nthreads, work_queue);
+        run(suite, "cllist__stack", nthreads, work_stack);
+        run(suite, "mutex+llist", nthreads, work_mutex);
+    }
+    mtx_destroy(&lock);
+    llist__destroy(&lst);
+    cllist__stack_destroy(&s);
+    cllist__queue_destroy(&q);
+}
@@ -0,0 +1,49 @@
+#include "bench.h"
+#include "llist/illist.h"
+#include "llist/llist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+void bench_illist__append (bench__Suite * suite) {
+    // link objects that already exist in an array, without and with a
+    // separately allocated node per object
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+        Item * items = malloc(sizeof(Item) * n);
+        if (items == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for benchmark items.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            LinkedList * lst = llist__create();
+            for (size_t i = 0; i < n; i++) {
+                llist__append(lst, (void *) &items[i]);
+            }
+            bench__pause(suite);
+            llist__destroy(&lst);
+            bench__resume(suite);
+        }
+        bench__end(suite, "illist__append", "LinkedList", n, n * nreps);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            IntrusiveList * lst = illist__create();
+            for (size_t i = 0; i < n; i++) {
+                illist__append(lst, &items[i].link);
+            }
+            bench__pause(suite);
+            illist__destroy(&lst);
+            bench__resume(suite);
+        }
+        bench__end(suite, "illist__append", "default", n, n * nreps);
+
+        free(items);
+    }
+}
@@ -0,0 +1,35 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+void bench_llist__append_array (bench__Suite * suite) {
+    // fill a list from an array with one call versus one append per item
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+        bench__Payloads payloads = bench__payloads_create(n, false);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            LinkedList * lst = llist__create();
+            for (size_t i = 0; i < n; i++) {
+                llist__append(lst, payloads.items[i]);
+            }
+            bench__pause(suite);
+            llist__destroy(&lst);
+            bench__resume(suite);
+        }
+        bench__end(suite, "llist__append_array", "append loop", n, n * nreps);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            LinkedList * lst = llist__create();
+            llist__append_array(lst, payloads.items, n);
+            bench__pause(suite);
+            llist__destroy(&lst);
+            bench__resume(suite);
+        }
+        bench__end(suite, "llist__append_array", "default", n, n * nreps);
+
+        bench__payloads_destroy(&payloads);
+    }
+}
@@ -0,0 +1,62 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static int cmp_ints (const void * a, const void * b, void *) {
+    int x = *((const int *) a);
+    int y = *((const int *) b);
+    return (x > y) - (x < y);
+}
+
+static void traverse (bench__Suite * suite, const char * label, LinkedList * lst, size_t n) {
+    size_t nreps = bench__reps(n);
+    volatile long sink = 0;
+    bench__begin(suite);
+    for (size_t r = 0; r < nreps; r++) {
+        long sum = 0;
+        llist__Iter it = llist__iter_begin(lst);
+        while (llist__iter_next(&it)) {
+            sum += *((int *) llist__iter_get(&it));
+        }
+        sink += sum;
+    }
+    bench__end(suite, "llist__compact", label, n, n * nreps);
+}
+
+static void run (bench__Suite * suite, const char * variant, LinkedList * lst, size_t n) {
+    // append shuffled payloads, then sort them: the payloads end up in
+    // memory order, but the nodes are scattered across the heap
+    char label[64];
+    bench__Payloads payloads = bench__payloads_create(n, true);
+    llist__append_array(lst, payloads.items, n);
+    llist__sort(lst, cmp_ints, NULL);
+
+    snprintf(label, sizeof(label), "%s, traverse scattered", variant);
+    traverse(suite, label, lst, n);
+
+    bench__begin(suite);
+    llist__compact(lst);
+    snprintf(label, sizeof(label), "%s, compact", variant);
+    bench__end(suite, "llist__compact", label, n, n);
+
+    snprintf(label, sizeof(label), "%s, traverse compacted", variant);
+    traverse(suite, label, lst, n);
+
+    bench__payloads_destroy(&payloads);
+}
+
+void bench_llist__compact (bench__Suite * suite) {
+    // traversal speed before and after compacting, and the cost of
+    // compacting itself
+    for (size_t n = 1000; n <= suite->maxsize; n *= 10) {
+        LinkedList * lst = llist__create();
+        run(suite, "malloc", lst, n);
+        llist__destroy(&lst);
+
+        llist__NodePool * pool = llist__pool_create(4096);
+        lst = llist__create_with_pool(pool);
+        run(suite, "pooled", lst, n);
+        llist__destroy(&lst);
+        llist__pool_destroy(&pool);
+    }
+}
@@ -0,0 +1,38 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+void bench_llist__create (bench__Suite * suite) {
+    // cost of creating an empty list, with and without a pool
+    constexpr size_t nops = 100000;
+    LinkedList ** lists = malloc(sizeof(LinkedList *) * nops);
+    if (lists == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for benchmark lists.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    bench__begin(suite);
+    for (size_t i = 0; i < nops; i++) {
+        lists[i] = llist__create();
+    }
+    bench__pause(suite);
+    for (size_t i = 0; i < nops; i++) {
+        llist__destroy(&lists[i]);
+    }
+    bench__end(suite, "llist__create", "default", 0, nops);
+
+    llist__NodePool * pool = llist__pool_create(64);
+    bench__begin(suite);
+    for (size_t i = 0; i < nops; i++) {
+        lists[i] = llist__create_with_pool(pool);
+    }
+    bench__pause(suite);
+    for (size_t i = 0; i < nops; i++) {
+        llist__destroy(&lists[i]);
+    }
+    bench__end(suite, "llist__create_with_pool", "default", 0, nops);
+    llist__pool_destroy(&pool);
+
+    free(lists);
+}
@@ -0,0 +1,89 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static int sentinel = -1;
+
+static bool is_sentinel (void * item) {
+    // decides on the pointer alone, so the payload is never touched
+    return item == (void *) &sentinel;
+}
+
+static bool is_negative (void * item) {
+    return *((int *) item) < 0;
+}
+
+static bool is_odd (void * item) {
+    return (*((int *) item) & 1) == 1;
+}
+
+static bool is_odd_index (void * item) {
+    // payload-free stand-in for is_odd: alternates on every call
+    static size_t ncalls = 0;
+    (void) item;
+    return (ncalls++ & 1) == 1;
+}
+
+static const struct {
+    const char * name;
+    bool touch;
+    bool shuffled;
+} patterns[] = {
+    { .name = "no payload access", .touch = false, .shuffled = false },
+    { .name = "sequential payloads", .touch = true, .shuffled = false },
+    { .name = "shuffled payloads", .touch = true, .shuffled = true },
+};
+
+static void run_global (bench__Suite * suite, size_t n, size_t p) {
+    // remove every other item in one pass; the cost is per item visited
+    size_t nreps = bench__reps(n);
+    bench__Payloads payloads = bench__payloads_create(n, patterns[p].shuffled);
+    bench__begin(suite);
+    for (size_t r = 0; r < nreps; r++) {
+        bench__pause(suite);
+        LinkedList * lst = llist__create();
+        llist__append_array(lst, payloads.items, n);
+        bench__resume(suite);
+        llist__delete(true, lst, patterns[p].touch ? is_odd : is_odd_index);
+        bench__pause(suite);
+        llist__destroy(&lst);
+        bench__resume(suite);
+    }
+    char variant[64];
+    snprintf(variant, sizeof(variant), "global, %s", patterns[p].name);
+    bench__end(suite, "llist__delete", variant, n, n * nreps);
+    bench__payloads_destroy(&payloads);
+}
+
+static void run_first (bench__Suite * suite, size_t n, size_t p) {
+    // the only match sits at the end of the list, so every call scans all
+    // of it before putting the match back. The cost is per call.
+    size_t nreps = bench__reps(n) / 10 + 1;
+    bench__Payloads payloads = bench__payloads_create(n, patterns[p].shuffled);
+    LinkedList * lst = llist__create();
+    llist__append_array(lst, payloads.items, n);
+    llist__append(lst, (void *) &sentinel);
+    bench__begin(suite);
+    for (size_t r = 0; r < nreps; r++) {
+        llist__delete(false, lst, patterns[p].touch ? is_negative : is_sentinel);
+        llist__append(lst, (void *) &sentinel);
+    }
+    char variant[64];
+    snprintf(variant, sizeof(variant), "first, %s", patterns[p].name);
+    bench__end(suite, "llist__delete", variant, n, nreps);
+    llist__destroy(&lst);
+    bench__payloads_destroy(&payloads);
+}
+
+void bench_llist__delete (bench__Suite * suite) {
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+        for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+            run_first(suite, n, p);
+        }
+    }
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+        for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+            run_global(suite, n, p);
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdint.h>
+#include <stdio.h>
+
+static int target = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static bool is_target (void * item) {
+    return *((int *) item) == target;
+}
+
+static void run (bench__Suite * suite, size_t n, bool keyed) {
+    // delete an item with a pseudo-random key and put it back at the end;
+    // the filter scan visits half of the list per call on average
+    bench__Payloads payloads = bench__payloads_create(n, true);
+    LinkedList * lst = llist__create();
+    if (keyed) {
+        llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+        llist__set_keyed(lst, &ops);
+    }
+    llist__append_array(lst, payloads.items, n);
+    size_t nops = keyed ? 1000000 : bench__reps(n) / 10 + 1;
+    unsigned int seed = 12345;
+    bench__begin(suite);
+    for (size_t i = 0; i < nops; i++) {
+        seed = seed * 1103515245 + 12345;
+        target = (int) ((seed >> 8) % n);
+        if (keyed) {
+            llist__delete_key(lst, &target);
+        } else {
+            llist__delete(false, lst, is_target);
+        }
+        llist__append(lst, (void *) &payloads.values[target]);
+    }
+    bench__end(suite, "llist__delete_key", keyed ? "keyed" : "filter scan", n, nops);
+    llist__destroy(&lst);
+    bench__payloads_destroy(&payloads);
+}
+
+void bench_llist__delete_key (bench__Suite * suite) {
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        run(suite, n, true);
+        run(suite, n, false);
+    }
+}
@@ -0,0 +1,72 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+#define NSET 8
+
+static int threshold = 0;
+
+static llist__Scalar set[NSET];
+
+static bool is_greater (void * p) {
+    return *((int *) p) > threshold;
+}
+
+static bool is_in_set (void * p) {
+    int x = *((int *) p);
+    for (size_t k = 0; k < NSET; k++) {
+        if (x == set[k].i) return true;
+    }
+    return false;
+}
+
+static void run (bench__Suite * suite, const char * name, bool (*filter)(void *), const llist__Where * where,
+                 bench__Payloads * payloads, size_t n) {
+    // deleted items are put back outside of the measurement
+    char variant[64];
+    size_t nreps = bench__reps(n);
+    for (size_t v = 0; v < 2; v++) {
+        LinkedList * lst = llist__create();
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            bench__pause(suite);
+            llist__destroy(&lst);
+            lst = llist__create();
+            llist__append_array(lst, payloads->items, n);
+            bench__resume(suite);
+            if (v == 0) {
+                llist__delete(true, lst, filter);
+            } else {
+                llist__delete_where(lst, where);
+            }
+        }
+        snprintf(variant, sizeof(variant), "%s, %s", name, v == 0 ? "filter" : "where");
+        bench__end(suite, "llist__delete_where", variant, n, n * nreps);
+        llist__destroy(&lst);
+    }
+}
+
+void bench_llist__delete_where (bench__Suite * suite) {
+    // a filter function against the equivalent built-in predicate, for a
+    // comparison that deletes nothing or half of the items, and for a
+    // lookup in a set of 8 values that deletes nothing
+    for (size_t k = 0; k < NSET; k++) {
+        set[k].i = -1 - (int) k;
+    }
+    for (size_t n = 1000; n <= suite->maxsize; n *= 10) {
+        bench__Payloads payloads = bench__payloads_create(n, false);
+
+        threshold = (int) n;
+        llist__Where where = { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_GT, .value = { .i = threshold } };
+        run(suite, "gt, delete none", is_greater, &where, &payloads, n);
+
+        threshold = (int) n / 2;
+        where.value.i = threshold;
+        run(suite, "gt, delete half", is_greater, &where, &payloads, n);
+
+        where = (llist__Where) { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_IN, .set = set, .nset = NSET };
+        run(suite, "in, delete none", is_in_set, &where, &payloads, n);
+
+        bench__payloads_destroy(&payloads);
+    }
+}
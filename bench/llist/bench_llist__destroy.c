@@ -0,0 +1,38 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+void bench_llist__destroy (bench__Suite * suite) {
+    // cost per item of tearing down a list of n items, with nodes from
+    // malloc and from a pool
+    static int item = 0;
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            bench__pause(suite);
+            LinkedList * lst = llist__create();
+            for (size_t i = 0; i < n; i++) {
+                llist__append(lst, (void *) &item);
+            }
+            bench__resume(suite);
+            llist__destroy(&lst);
+        }
+        bench__end(suite, "llist__destroy", "default", n, n * nreps);
+
+        llist__NodePool * pool = llist__pool_create(4096);
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            bench__pause(suite);
+            LinkedList * lst = llist__create_with_pool(pool);
+            for (size_t i = 0; i < n; i++) {
+                llist__append(lst, (void *) &item);
+            }
+            bench__resume(suite);
+            llist__destroy(&lst);
+        }
+        bench__end(suite, "llist__destroy", "pooled", n, n * nreps);
+        llist__pool_destroy(&pool);
+    }
+}
@@ -0,0 +1,45 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static const struct {
+    const char * name;
+    bool touch;
+    bool shuffled;
+} patterns[] = {
+    { .name = "no payload access", .touch = false, .shuffled = false },
+    { .name = "sequential payloads", .touch = true, .shuffled = false },
+    { .name = "shuffled payloads", .touch = true, .shuffled = true },
+};
+
+void bench_llist__iter_next (bench__Suite * suite) {
+    // a full traversal, optionally reading every payload; with shuffled
+    // payloads each read lands somewhere else in memory
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+        for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+            size_t nreps = bench__reps(n);
+            bench__Payloads payloads = bench__payloads_create(n, patterns[p].shuffled);
+            LinkedList * lst = llist__create();
+            llist__append_array(lst, payloads.items, n);
+            volatile long sink = 0;
+            bench__begin(suite);
+            for (size_t r = 0; r < nreps; r++) {
+                long sum = 0;
+                llist__Iter it = llist__iter_begin(lst);
+                if (patterns[p].touch) {
+                    while (llist__iter_next(&it)) {
+                        sum += *((int *) llist__iter_get(&it));
+                    }
+                } else {
+                    while (llist__iter_next(&it)) {
+                        sum += (long) (llist__iter_get(&it) != NULL);
+                    }
+                }
+                sink += sum;
+            }
+            bench__end(suite, "llist__iter_next", patterns[p].name, n, n * nreps);
+            llist__destroy(&lst);
+            bench__payloads_destroy(&payloads);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#define _POSIX_C_SOURCE 200809L
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static size_t int_size (const void *, void *) {
+    return sizeof(int);
+}
+
+void bench_llist__load_mmap (bench__Suite * suite) {
+    // restore a list of ints from disk: read the ints back and append
+    // them one by one, versus mapping a snapshot
+    for (size_t n = 1000; n <= suite->maxsize; n *= 10) {
+        char path[] = "/tmp/bench_llist__load_mmap_XXXXXX";
+        int fd = mkstemp(path);
+        if (fd < 0) {
+            fprintf(stderr, "Something went wrong creating a temporary file.\n");
+            exit(EXIT_FAILURE);
+        }
+        bench__Payloads payloads = bench__payloads_create(n, false);
+        LinkedList * lst = llist__create();
+        llist__append_array(lst, payloads.items, n);
+        llist__Codec codec = { .size = int_size };
+        llist__save(lst, fd, &codec);
+        llist__destroy(&lst);
+        FILE * fp = tmpfile();
+        fwrite(payloads.values, sizeof(int), n, fp);
+        fflush(fp);
+        bench__payloads_destroy(&payloads);
+
+        bench__begin(suite);
+        rewind(fp);
+        int * values = malloc(sizeof(int) * n);
+        if (values == NULL || fread(values, sizeof(int), n, fp) != n) {
+            fprintf(stderr, "Something went wrong reading back benchmark values.\n");
+            exit(EXIT_FAILURE);
+        }
+        lst = llist__create();
+        for (size_t i = 0; i < n; i++) {
+            llist__append(lst, (void *) &values[i]);
+        }
+        bench__end(suite, "llist__load_mmap", "fread+llist__append", n, n);
+        llist__destroy(&lst);
+        free(values);
+        fclose(fp);
+
+        bench__begin(suite);
+        lst = llist__load_mmap(path);
+        bench__end(suite, "llist__load_mmap", "default", n, n);
+        llist__destroy(&lst);
+
+        close(fd);
+        unlink(path);
+    }
+}
@@ -0,0 +1,82 @@
+#include "bench.h"
+#include "llist/lru.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static size_t * zipf_samples (size_t nkeys, double s, size_t nsamples) {
+    // key k is drawn with probability proportional to 1 / (k + 1)^s,
+    // by binary search in the cumulative distribution
+    double * cdf = malloc(sizeof(double) * nkeys);
+    size_t * samples = malloc(sizeof(size_t) * nsamples);
+    if (cdf == NULL || samples == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the Zipf distribution.\n");
+        exit(EXIT_FAILURE);
+    }
+    double sum = 0.0;
+    for (size_t k = 0; k < nkeys; k++) {
+        sum += 1.0 / pow((double) (k + 1), s);
+        cdf[k] = sum;
+    }
+    uint64_t seed = 12345;
+    for (size_t i = 0; i < nsamples; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        double u = (double) (seed >> 11) / 9007199254740992.0 * sum;
+        size_t lo = 0;
+        size_t hi = nkeys - 1;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (cdf[mid] < u) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        samples[i] = lo;
+    }
+    free(cdf);
+    return samples;
+}
+
+static void run (bench__Suite * suite, size_t n, double s) {
+    // n distinct keys, of which the cache holds a tenth; every miss puts
+    // the key in the cache, evicting the least recently used one
+    size_t nops = 1000000;
+    size_t * samples = zipf_samples(n, s, nops);
+    bench__Payloads payloads = bench__payloads_create(n, false);
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__LruCache * cache = llist__lru_create(n < 10 ? 1 : n / 10, &ops, NULL, NULL);
+    size_t nhits = 0;
+    bench__begin(suite);
+    for (size_t i = 0; i < nops; i++) {
+        int * key = &payloads.values[samples[i]];
+        if (llist__lru_get(cache, key) != NULL) {
+            nhits++;
+        } else {
+            llist__lru_put(cache, key, key);
+        }
+    }
+    bench__hit_rate(suite, (double) nhits / (double) nops);
+    char variant[64];
+    snprintf(variant, sizeof(variant), "zipf %.2f, capacity n / 10", s);
+    bench__end(suite, "llist__lru", variant, n, nops);
+    llist__lru_destroy(&cache);
+    bench__payloads_destroy(&payloads);
+    free(samples);
+}
+
+void bench_llist__lru (bench__Suite * suite) {
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        run(suite, n, 0.8);
+        run(suite, n, 0.99);
+    }
+}
@@ -0,0 +1,42 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static bool expensive (void * p, void *) {
+    // a predicate that does some real work per item
+    unsigned int x = (unsigned int) *((int *) p);
+    for (int i = 0; i < 64; i++) {
+        x = x * 1103515245 + 12345;
+    }
+    return (x & 3) == 0;
+}
+
+void bench_llist__parallel_filter (bench__Suite * suite) {
+    // deleting with an expensive predicate, serially and with a growing
+    // number of threads
+    for (size_t n = 10000; n <= suite->maxsize; n *= 10) {
+        bench__Payloads payloads = bench__payloads_create(n, false);
+
+        bench__begin(suite);
+        bench__pause(suite);
+        LinkedList * lst = llist__create();
+        llist__append_array(lst, payloads.items, n);
+        bench__resume(suite);
+        llist__delete_ctx(lst, expensive, NULL, SIZE_MAX, NULL);
+        bench__end(suite, "llist__parallel_filter", "llist__delete_ctx", n, n);
+        llist__destroy(&lst);
+
+        for (size_t nthreads = 1; nthreads <= 8; nthreads *= 2) {
+            lst = llist__create();
+            llist__append_array(lst, payloads.items, n);
+            char variant[32];
+            snprintf(variant, sizeof(variant), "threads=%zu", nthreads);
+            bench__begin(suite);
+            llist__parallel_filter(lst, expensive, NULL, nthreads);
+            bench__end(suite, "llist__parallel_filter", variant, n, n);
+            llist__destroy(&lst);
+        }
+
+        bench__payloads_destroy(&payloads);
+    }
+}
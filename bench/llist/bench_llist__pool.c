@@ -0,0 +1,52 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static bool keep (void *) {
+    return false;
+}
+
+static void run (bench__Suite * suite, const char * variant, LinkedList * lst, size_t n) {
+    // build, scan, and churn through a list; churning pops the first item
+    // and appends a new one, which recycles a node on every step
+    static int item = 0;
+    char label[64];
+
+    bench__begin(suite);
+    for (size_t i = 0; i < n; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    snprintf(label, sizeof(label), "%s, append", variant);
+    bench__end(suite, "llist__pool", label, n, n);
+
+    bench__begin(suite);
+    llist__delete(true, lst, keep);
+    snprintf(label, sizeof(label), "%s, scan", variant);
+    bench__end(suite, "llist__pool", label, n, n);
+
+    bench__begin(suite);
+    for (size_t i = 0; i < n; i++) {
+        llist__pop_front(lst);
+        llist__append(lst, (void *) &item);
+    }
+    snprintf(label, sizeof(label), "%s, churn", variant);
+    bench__end(suite, "llist__pool", label, n, n);
+}
+
+void bench_llist__pool (bench__Suite * suite) {
+    // compare per-node malloc against nodes drawn from a shared pool; the
+    // malloc variant keeps no spare nodes, so that churning frees and
+    // allocates on every step
+    for (size_t n = 1000; n <= suite->maxsize; n *= 10) {
+        LinkedList * lst = llist__create();
+        llist__shrink_to_fit(lst);
+        run(suite, "malloc", lst, n);
+        llist__destroy(&lst);
+
+        llist__NodePool * pool = llist__pool_create(4096);
+        lst = llist__create_with_pool(pool);
+        run(suite, "pooled", lst, n);
+        llist__destroy(&lst);
+        llist__pool_destroy(&pool);
+    }
+}
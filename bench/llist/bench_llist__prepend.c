@@ -0,0 +1,24 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+void bench_llist__prepend (bench__Suite * suite) {
+    // cost per prepend while growing empty lists to n items
+    static int item = 0;
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            bench__pause(suite);
+            LinkedList * lst = llist__create();
+            bench__resume(suite);
+            for (size_t i = 0; i < n; i++) {
+                llist__prepend(lst, (void *) &item);
+            }
+            bench__pause(suite);
+            llist__destroy(&lst);
+            bench__resume(suite);
+        }
+        bench__end(suite, "llist__prepend", "default", n, n * nreps);
+    }
+}
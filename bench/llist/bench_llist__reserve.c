@@ -0,0 +1,60 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static void run (bench__Suite * suite, const char * variant, LinkedList * lst, size_t n) {
+    // churning pops the first item and appends a new one, which frees and
+    // allocates a node on every step unless released nodes are reused;
+    // bursts fill the list with n items and then drain it again
+    static int item = 0;
+    char label[64];
+    size_t nreps = bench__reps(n);
+
+    for (size_t i = 0; i < n; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    bench__begin(suite);
+    for (size_t r = 0; r < nreps; r++) {
+        for (size_t i = 0; i < n; i++) {
+            llist__pop_front(lst);
+            llist__append(lst, (void *) &item);
+        }
+    }
+    snprintf(label, sizeof(label), "churn, %s", variant);
+    bench__end(suite, "llist__reserve", label, n, n * nreps);
+
+    while (llist__get_length(lst) > 0) {
+        llist__pop_front(lst);
+    }
+    bench__begin(suite);
+    for (size_t r = 0; r < nreps; r++) {
+        for (size_t i = 0; i < n; i++) {
+            llist__append(lst, (void *) &item);
+        }
+        for (size_t i = 0; i < n; i++) {
+            llist__pop_front(lst);
+        }
+    }
+    snprintf(label, sizeof(label), "burst, %s", variant);
+    bench__end(suite, "llist__reserve", label, n, 2 * n * nreps);
+}
+
+void bench_llist__reserve (bench__Suite * suite) {
+    // compare freeing every released node, keeping the default number of
+    // spare nodes, and reserving nodes for the whole list up front
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        LinkedList * lst = llist__create();
+        llist__shrink_to_fit(lst);
+        run(suite, "no spares", lst, n);
+        llist__destroy(&lst);
+
+        lst = llist__create();
+        run(suite, "default", lst, n);
+        llist__destroy(&lst);
+
+        lst = llist__create();
+        llist__reserve(lst, n);
+        run(suite, "reserved", lst, n);
+        llist__destroy(&lst);
+    }
+}
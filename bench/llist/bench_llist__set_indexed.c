@@ -0,0 +1,41 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+
+static void run (bench__Suite * suite, size_t n, bool indexed) {
+    // grow a list to n items, then time inserts and gets at pseudo-random
+    // positions, alternately; the list at most doubles in length
+    static int item = 0;
+    size_t nops = n < 1000 ? n : 1000;
+    size_t nreps = n < 1000 ? 1000 / n : 1;
+    unsigned int seed = 12345;
+    bench__begin(suite);
+    for (size_t r = 0; r < nreps; r++) {
+        bench__pause(suite);
+        LinkedList * lst = llist__create();
+        llist__set_indexed(lst, indexed);
+        for (size_t i = 0; i < n; i++) {
+            llist__append(lst, (void *) &item);
+        }
+        bench__resume(suite);
+        for (size_t i = 0; i < nops; i++) {
+            seed = seed * 1103515245 + 12345;
+            llist__insert(seed % (llist__get_length(lst) + 1), (void *) &item, lst);
+            seed = seed * 1103515245 + 12345;
+            llist__get(seed % llist__get_length(lst), lst);
+        }
+        bench__pause(suite);
+        llist__destroy(&lst);
+        bench__resume(suite);
+    }
+    bench__end(suite, "llist__set_indexed", indexed ? "insert+get, indexed" : "insert+get, linear", n,
+               2 * nops * nreps);
+}
+
+void bench_llist__set_indexed (bench__Suite * suite) {
+    // positional access with and without the skip index
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        run(suite, n, false);
+        run(suite, n, true);
+    }
+}
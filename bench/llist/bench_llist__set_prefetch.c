@@ -0,0 +1,73 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdint.h>
+#include <stdio.h>
+
+static const size_t distances[] = { 0, 4, 16, 64 };
+
+static uint64_t scramble (int value) {
+    uint64_t x = (uint64_t) value;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static int cmp_scrambled (const void * a, const void * b, void *) {
+    uint64_t x = scramble(*((const int *) a));
+    uint64_t y = scramble(*((const int *) b));
+    return (x > y) - (x < y);
+}
+
+static bool is_negative (void * p) {
+    return *((int *) p) < 0;
+}
+
+static LinkedList * build (bench__Payloads * payloads, size_t n) {
+    // nodes are allocated in shuffled payload order, then sorted into an
+    // order unrelated to both, such that neither nodes nor payloads are
+    // adjacent in traversal order
+    LinkedList * lst = llist__create();
+    llist__append_array(lst, payloads->items, n);
+    llist__sort(lst, cmp_scrambled, NULL);
+    return lst;
+}
+
+void bench_llist__set_prefetch (bench__Suite * suite) {
+    // full traversals of lists that are scattered across a heap much larger
+    // than the caches, with and without prefetching; delete reads every
+    // payload, destroy reads only the nodes
+    char variant[64];
+    for (size_t n = 100000; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+        bench__Payloads payloads = bench__payloads_create(n, true);
+        LinkedList * lst = build(&payloads, n);
+        for (size_t d = 0; d < sizeof(distances) / sizeof(distances[0]); d++) {
+            for (size_t p = 0; p < 2; p++) {
+                if (distances[d] == 0 && p == 1) continue;
+                llist__set_prefetch(lst, distances[d], p == 1);
+                // the first traversal records the addresses that the
+                // timed ones replay
+                llist__delete(true, lst, is_negative);
+                bench__begin(suite);
+                for (size_t r = 0; r < nreps; r++) {
+                    llist__delete(true, lst, is_negative);
+                }
+                snprintf(variant, sizeof(variant), "delete, distance=%zu%s", distances[d], p == 1 ? ", payloads" : "");
+                bench__end(suite, "llist__set_prefetch", variant, n, n * nreps);
+            }
+        }
+        llist__destroy(&lst);
+
+        for (size_t d = 0; d < sizeof(distances) / sizeof(distances[0]); d += 2) {
+            lst = build(&payloads, n);
+            llist__set_prefetch(lst, distances[d], false);
+            llist__delete(true, lst, is_negative);
+            bench__begin(suite);
+            llist__destroy(&lst);
+            snprintf(variant, sizeof(variant), "destroy, distance=%zu", distances[d]);
+            bench__end(suite, "llist__set_prefetch", variant, n, n);
+        }
+        bench__payloads_destroy(&payloads);
+    }
+}
@@ -0,0 +1,64 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static int by_value (const void * a, const void * b, void *) {
+    int x = *((const int *) a);
+    int y = *((const int *) b);
+    return (x > y) - (x < y);
+}
+
+static int by_pointee (const void * a, const void * b) {
+    int x = **((int * const *) a);
+    int y = **((int * const *) b);
+    return (x > y) - (x < y);
+}
+
+static LinkedList * fill (int * values, size_t n) {
+    LinkedList * lst = llist__create();
+    for (size_t i = 0; i < n; i++) {
+        llist__append(lst, (void *) &values[i]);
+    }
+    return lst;
+}
+
+void bench_llist__sort (bench__Suite * suite) {
+    // in-place merge sort versus copying the payloads into an array,
+    // qsort'ing that, and rebuilding the list from it
+    for (size_t n = 1000; n <= suite->maxsize; n *= 10) {
+        int * values = malloc(sizeof(int) * n);
+        void ** items = malloc(sizeof(void *) * n);
+        if (values == NULL || items == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for benchmark items.\n");
+            exit(EXIT_FAILURE);
+        }
+        unsigned int seed = 12345;
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            values[i] = (int) (seed >> 4);
+        }
+
+        LinkedList * lst = fill(values, n);
+        bench__begin(suite);
+        llist__sort(lst, by_value, NULL);
+        bench__end(suite, "llist__sort", "default", n, n);
+        llist__destroy(&lst);
+
+        lst = fill(values, n);
+        bench__begin(suite);
+        llist__Iter it = llist__iter_begin(lst);
+        for (size_t i = 0; llist__iter_next(&it); i++) {
+            items[i] = llist__iter_get(&it);
+        }
+        llist__destroy(&lst);
+        qsort(items, n, sizeof(void *), by_pointee);
+        lst = llist__create();
+        llist__append_array(lst, items, n);
+        bench__end(suite, "llist__sort", "copy+qsort+rebuild", n, n);
+        llist__destroy(&lst);
+
+        free(items);
+        free(values);
+    }
+}
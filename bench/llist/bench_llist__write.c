@@ -0,0 +1,50 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * p) {
+    fprintf(fd, "%d%s", *((int *) p), idx < nelems - 1 ? ", " : "");
+}
+
+void bench_llist__write (bench__Suite * suite) {
+    // dump a list of ints to /dev/null with a printer callback per item
+    // versus the buffered writer, in text and in binary
+    FILE * devnull = fopen("/dev/null", "w");
+    if (devnull == NULL) {
+        fprintf(stderr, "Something went wrong opening /dev/null.\n");
+        exit(EXIT_FAILURE);
+    }
+    llist__Printers printers = { .elem = print_elem };
+    llist__WriteOptions text = { .format = LLIST_FORMAT_INT };
+    llist__WriteOptions binary = { .format = LLIST_FORMAT_INT, .binary = true };
+    for (size_t n = 1000; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+        bench__Payloads payloads = bench__payloads_create(n, false);
+        LinkedList * lst = llist__create();
+        llist__append_array(lst, payloads.items, n);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            llist__print(lst, &printers, devnull);
+            fflush(devnull);
+        }
+        bench__end(suite, "llist__write", "llist__print", n, n * nreps);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            llist__write(lst, &text, fileno(devnull));
+        }
+        bench__end(suite, "llist__write", "default", n, n * nreps);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            llist__write(lst, &binary, fileno(devnull));
+        }
+        bench__end(suite, "llist__write", "binary", n, n * nreps);
+
+        llist__destroy(&lst);
+        bench__payloads_destroy(&payloads);
+    }
+    fclose(devnull);
+}
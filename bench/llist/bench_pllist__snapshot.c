@@ -0,0 +1,54 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include "llist/pllist.h"
+#include <stdio.h>
+#include <threads.h>
+
+void bench_pllist__snapshot (bench__Suite * suite) {
+    // cost of handing a reader a stable view of an n item list: a copy
+    // of a LinkedList taken under the writer's lock, against a snapshot
+    // of a PersistentList version
+    static int item = 0;
+    mtx_t lock;
+    mtx_init(&lock, mtx_plain);
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+
+        LinkedList * lst = llist__create();
+        PersistentList * current = pllist__create();
+        for (size_t i = 0; i < n; i++) {
+            llist__append(lst, (void *) &item);
+            PersistentList * next = pllist__prepend(current, (void *) &item);
+            pllist__destroy(&current);
+            current = next;
+        }
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            mtx_lock(&lock);
+            LinkedList * copy = llist__create();
+            llist__Iter it = llist__iter_begin(lst);
+            while (llist__iter_next(&it)) {
+                llist__append(copy, llist__iter_get(&it));
+            }
+            mtx_unlock(&lock);
+            bench__pause(suite);
+            llist__destroy(&copy);
+            bench__resume(suite);
+        }
+        bench__end(suite, "pllist__snapshot", "copy+mutex", n, nreps);
+
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            PersistentList * snapshot = pllist__snapshot(current);
+            bench__pause(suite);
+            pllist__destroy(&snapshot);
+            bench__resume(suite);
+        }
+        bench__end(suite, "pllist__snapshot", "default", n, nreps);
+
+        pllist__destroy(&current);
+        llist__destroy(&lst);
+    }
+    mtx_destroy(&lock);
+}
@@ -0,0 +1,48 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include "llist/tllist.h"
+#include <stdio.h>
+
+LLIST_DEFINE(ilist, int)
+
+static void add (int * elem, void * ctx) {
+    *((long *) ctx) += *elem;
+}
+
+void bench_tllist__for_each (bench__Suite * suite) {
+    // sum every payload of a list whose ints live inside the nodes,
+    // against a LinkedList pointing at ints scattered over the heap
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+        volatile long sink = 0;
+
+        bench__Payloads payloads = bench__payloads_create(n, true);
+        LinkedList * lst = llist__create();
+        llist__append_array(lst, payloads.items, n);
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            long sum = 0;
+            llist__Iter it = llist__iter_begin(lst);
+            while (llist__iter_next(&it)) {
+                sum += *((int *) llist__iter_get(&it));
+            }
+            sink += sum;
+        }
+        bench__end(suite, "tllist__for_each", "LinkedList, shuffled payloads", n, n * nreps);
+        llist__destroy(&lst);
+        bench__payloads_destroy(&payloads);
+
+        ilist * ilst = ilist__create();
+        for (size_t i = 0; i < n; i++) {
+            ilist__append(ilst, (int) i);
+        }
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            long sum = 0;
+            ilist__for_each(ilst, add, &sum);
+            sink += sum;
+        }
+        bench__end(suite, "tllist__for_each", "default", n, n * nreps);
+        ilist__destroy(&ilst);
+    }
+}
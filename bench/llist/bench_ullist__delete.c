@@ -0,0 +1,39 @@
+#include "bench.h"
+#include "llist/llist.h"
+#include "llist/ullist.h"
+#include <stdio.h>
+
+static bool keep (void *) {
+    return false;
+}
+
+void bench_ullist__delete (bench__Suite * suite) {
+    // full scans of a LinkedList versus an UnrolledList holding the same
+    // items; the scan is a global delete whose filter never matches
+    static int item = 0;
+    for (size_t n = 10; n <= suite->maxsize; n *= 10) {
+        size_t nreps = bench__reps(n);
+
+        LinkedList * lst = llist__create();
+        for (size_t i = 0; i < n; i++) {
+            llist__append(lst, (void *) &item);
+        }
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            llist__delete(true, lst, keep);
+        }
+        bench__end(suite, "ullist__delete", "LinkedList scan", n, n * nreps);
+        llist__destroy(&lst);
+
+        UnrolledList * ulst = ullist__create();
+        for (size_t i = 0; i < n; i++) {
+            ullist__append(ulst, (void *) &item);
+        }
+        bench__begin(suite);
+        for (size_t r = 0; r < nreps; r++) {
+            ullist__delete(true, ulst, keep);
+        }
+        bench__end(suite, "ullist__delete", "default", n, n * nreps);
+        ullist__destroy(&ulst);
+    }
+}
@@ -0,0 +1,85 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const struct {
+    const char * name;
+    void (*run)(bench__Suite * suite);
+} benchmarks[] = {
+    { .name = "allist__delete", .run = bench_allist__delete },
+    { .name = "cllist__queue", .run = bench_cllist__queue },
+    { .name = "illist__append", .run = bench_illist__append },
+    { .name = "llist__append", .run = bench_llist__append },
+    { .name = "llist__append_array", .run = bench_llist__append_array },
+    { .name = "llist__compact", .run = bench_llist__compact },
+    { .name = "llist__create", .run = bench_llist__create },
+    { .name = "llist__delete", .run = bench_llist__delete },
+    { .name = "llist__delete_key", .run = bench_llist__delete_key },
+    { .name = "llist__delete_where", .run = bench_llist__delete_where },
+    { .name = "llist__destroy", .run = bench_llist__destroy },
+    { .name = "llist__insert", .run = bench_llist__insert },
+    { .name = "llist__iter_next", .run = bench_llist__iter_next },
+    { .name = "llist__load_mmap", .run = bench_llist__load_mmap },
+    { .name = "llist__lru", .run = bench_llist__lru },
+    { .name = "llist__parallel_filter", .run = bench_llist__parallel_filter },
+    { .name = "llist__pool", .run = bench_llist__pool },
+    { .name = "llist__prepend", .run = bench_llist__prepend },
+    { .name = "llist__reserve", .run = bench_llist__reserve },
+    { .name = "llist__set_indexed", .run = bench_llist__set_indexed },
+    { .name = "llist__set_prefetch", .run = bench_llist__set_prefetch },
+    { .name = "llist__sort", .run = bench_llist__sort },
+    { .name = "llist__write", .run = bench_llist__write },
+    { .name = "pllist__snapshot", .run = bench_pllist__snapshot },
+    { .name = "tllist__for_each", .run = bench_tllist__for_each },
+    { .name = "ullist__delete", .run = bench_ullist__delete },
+};
+
+static void usage (FILE * fd) {
+    fprintf(fd, "Usage: bench_llist [--max-size N] [--output FILE] [--filter SUBSTRING]\n"
+                "\n"
+                "Runs the benchmarks whose name contains SUBSTRING (default: all) on lists of\n"
+                "up to N items (default: 10000000), and writes the results as JSON to FILE\n"
+                "(default: stdout). A human readable summary is printed to stderr.\n");
+}
+
+int main (int argc, char * argv[]) {
+    size_t maxsize = 10000000;
+    const char * output = NULL;
+    const char * filter = "";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+            maxsize = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--help") == 0) {
+            usage(stdout);
+            return EXIT_SUCCESS;
+        } else {
+            usage(stderr);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE * fd = output == NULL ? stdout : fopen(output, "w");
+    if (fd == NULL) {
+        fprintf(stderr, "Something went wrong opening '%s' for writing.\n", output);
+        return EXIT_FAILURE;
+    }
+
+    bench__Suite suite;
+    bench__suite_init(&suite, fd, maxsize);
+    for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        if (strstr(benchmarks[i].name, filter) != NULL) {
+            benchmarks[i].run(&suite);
+        }
+    }
+    bench__suite_fini(&suite);
+
+    if (fd != stdout) {
+        fclose(fd);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file
+ */
+
+
+#ifndef ALLIST_H
+#define ALLIST_H
+#include "llist/llist.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief  Array-backed linked list. Instead of allocating a node per
+ *         item, it keeps the items and their links in parallel arrays
+ *         of slots, and links slots by their 32-bit index rather than
+ *         by pointer. A link costs 8 bytes instead of the 16 bytes of
+ *         pointers plus allocator overhead of a ::LinkedList node, a
+ *         traversal makes indexed loads into a few contiguous arrays,
+ *         and the whole list is relocated by growing the arrays with
+ *         `realloc`. Slots of removed items are kept on a freelist and
+ *         reused by later insertions. The API mirrors that of
+ *         ::LinkedList, so a list can be swapped for another by
+ *         changing the create call and the prefix:
+ *
+ *         @code{.c}
+ *         ArrayLinkedList * lst = allist__create(1024);
+ *         allist__append(lst, item);
+ *         allist__delete(true, lst, filter);
+ *         allist__destroy(&lst);
+ *         @endcode
+ *
+ *         An array-backed linked list holds at most ::ALLIST_MAX_LENGTH
+ *         items. The list does not own its items.
+ */
+typedef struct allist ArrayLinkedList;
+
+/**
+ * @brief  The maximum number of items an ::ArrayLinkedList can hold.
+ *         One index value is reserved to mark the end of the list.
+ */
+#define ALLIST_MAX_LENGTH ((size_t) UINT32_MAX)
+
+
+
+
+/**
+ * @brief       Append an item to an instance of an array-backed linked
+ *              list
+ * @details     Takes amortized constant time. The slot arrays double
+ *              in size when they are full.
+ * @param lst   The instance of an array-backed linked list to which \p
+ *              item is going to be appended.
+ * @param item  The item that is going to be appended to \p lst.
+ */
+void allist__append (ArrayLinkedList * lst, void * item);
+
+
+
+
+/**
+ * @brief           Create an instance of an array-backed linked list
+ * @param capacity  The number of slots to allocate up front. A list
+ *                  that never holds more than \p capacity items never
+ *                  reallocates. May be 0.
+ * @returns         A pointer to the created instance of an array-backed
+ *                  linked list.
+ */
+ArrayLinkedList * allist__create (const size_t capacity);
+
+
+
+
+/**
+ * @brief         Delete an item from an instance of an array-backed
+ *                linked list using a filter function
+ * @details       Behaves like ::llist__delete. The slots of the deleted
+ *                items are put on the freelist.
+ * @param global  If `true`, the deletion is applied globally, i.e. to
+ *                all items in \p lst that match according to \p
+ *                filter; if `false`, deletion is applied only to the
+ *                first matching item.
+ * @param lst     The instance of an array-backed linked list from which
+ *                an item is going to be deleted.
+ * @param filter  The function that is used to determine whether
+ *                individual items in \p lst qualify for deletion
+ *                (return value `true`) or that they should remain
+ *                (return value `false`).
+ */
+void allist__delete (const bool global, ArrayLinkedList * lst, bool (*filter)(void *));
+
+
+
+
+/**
+ * @brief      Destroy an instance of an array-backed linked list
+ * @details    Takes constant time.
+ * @param lst  The instance of an array-backed linked list whose memory
+ *             is going to be freed.
+ */
+void allist__destroy (ArrayLinkedList ** lst);
+
+
+
+
+/**
+ * @brief      Get the item at a given position of an array-backed
+ *             linked list
+ * @details    Walks from whichever end of the list is closest to \p
+ *             pos.
+ * @param pos  Zero based pseudo index of the item.
+ * @param lst  The array-backed linked list.
+ * @returns    The item at \p pos.
+ */
+void * allist__get (const size_t pos, const ArrayLinkedList * lst);
+
+
+
+
+/**
+ * @brief      Get the number of items currently stored in an instance
+ *             of an array-backed linked list
+ * @param lst  The instance of an array-backed linked list whose length
+ *             is being queried.
+ * @returns    The number of items in \p lst.
+ */
+size_t allist__get_length (const ArrayLinkedList * lst);
+
+
+
+
+/**
+ * @brief       Insert an item at a given position into an array-backed
+ *              linked list
+ * @details     Walks from whichever end of the list is closest to \p
+ *              pos.
+ * @param pos   Zero based pseudo index where \p item should be
+ *              inserted into \p lst.
+ * @param item  The item to be inserted.
+ * @param lst   The array-backed linked list into which \p item should
+ *              be inserted.
+ */
+void allist__insert (const size_t pos, void * item, ArrayLinkedList * lst);
+
+
+
+
+/**
+ * @brief      Remove the last item from an instance of an array-backed
+ *             linked list
+ * @details    Takes constant time. \p lst must not be empty.
+ * @param lst  The instance of an array-backed linked list whose last
+ *             item is going to be removed.
+ * @returns    The item that was removed from \p lst.
+ */
+void * allist__pop_back (ArrayLinkedList * lst);
+
+
+
+
+/**
+ * @brief      Remove the first item from an instance of an array-backed
+ *             linked list
+ * @details    Takes constant time. \p lst must not be empty.
+ * @param lst  The instance of an array-backed linked list whose first
+ *             item is going to be removed.
+ * @returns    The item that was removed from \p lst.
+ */
+void * allist__pop_front (ArrayLinkedList * lst);
+
+
+
+
+/**
+ * @brief       Prepend an item to an instance of an array-backed linked
+ *              list
+ * @details     Takes amortized constant time.
+ * @param lst   The instance of an array-backed linked list to which \p
+ *              item is going to be prepended.
+ * @param item  The item that is going to be prepended to \p lst.
+ */
+void allist__prepend (ArrayLinkedList * lst, void * item);
+
+
+
+
+/**
+ * @brief           Print the contents of an instance of an array-backed
+ *                  linked list, optionally using a custom printer
+ *                  function
+ * @details         Behaves like ::llist__print, and accepts the same
+ *                  printers.
+ * @param lst       The array-backed linked list whose contents should
+ *                  be printed.
+ * @param printers  The printer function pointers. A default printer
+ *                  function will be substituted for any member that
+ *                  is NULL. If \p printers itself is NULL, all of its
+ *                  printer functions will be substituted with default
+ *                  functions.
+ * @param fd        Where the output should be written. Typically,
+ *                  `stdout`.
+ */
+void allist__print (const ArrayLinkedList * lst, const llist__Printers * printers, FILE * fd);
+
+
+
+
+/**
+ * @brief      Remove the item at a given position from an array-backed
+ *             linked list
+ * @details    Walks from whichever end of the list is closest to \p
+ *             pos. The slot of the removed item is put on the
+ *             freelist.
+ * @param pos  Zero based pseudo index of the item to be removed.
+ * @param lst  The array-backed linked list.
+ * @returns    The item that was removed from \p lst.
+ */
+void * allist__remove (const size_t pos, ArrayLinkedList * lst);
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file
+ */
+
+
+#ifndef CLLIST_H
+#define CLLIST_H
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief  Lock-free LIFO stack (Treiber stack) that any number of
+ *         threads may push to and pop from concurrently.
+ */
+typedef struct cllist__stack ConcurrentStack;
+
+/**
+ * @brief  Lock-free FIFO queue (Michael-Scott queue) that any number
+ *         of threads may append to and pop from concurrently.
+ */
+typedef struct cllist__queue ConcurrentQueue;
+
+
+
+
+/**
+ * @brief       Append an item to a concurrent queue
+ * @details     Lock-free; safe to call from any number of threads
+ *              concurrently.
+ * @param q     The queue to which \p item is going to be appended.
+ * @param item  The item that is going to be appended to \p q.
+ */
+void cllist__queue_append (ConcurrentQueue * q, void * item);
+
+
+
+
+/**
+ * @brief    Create a concurrent queue
+ * @returns  A pointer to the created queue.
+ */
+ConcurrentQueue * cllist__queue_create (void);
+
+
+
+
+/**
+ * @brief     Destroy a concurrent queue
+ * @details   No other thread may be using \p q at this point.
+ * @param q   The queue whose memory is going to be freed.
+ */
+void cllist__queue_destroy (ConcurrentQueue ** q);
+
+
+
+
+/**
+ * @brief       Remove the first item from a concurrent queue
+ * @details     Lock-free; safe to call from any number of threads
+ *              concurrently. The removed node is reclaimed once no
+ *              other thread can be reading it anymore, using hazard
+ *              pointers.
+ * @param q     The queue whose first item is going to be removed.
+ * @param item  Where the removed item is stored. Left untouched if \p
+ *              q is empty.
+ * @returns     `true` if an item was removed, `false` if \p q was
+ *              empty.
+ */
+bool cllist__queue_pop_front (ConcurrentQueue * q, void ** item);
+
+
+
+
+/**
+ * @brief    Create a concurrent stack
+ * @returns  A pointer to the created stack.
+ */
+ConcurrentStack * cllist__stack_create (void);
+
+
+
+
+/**
+ * @brief     Destroy a concurrent stack
+ * @details   No other thread may be using \p s at this point.
+ * @param s   The stack whose memory is going to be freed.
+ */
+void cllist__stack_destroy (ConcurrentStack ** s);
+
+
+
+
+/**
+ * @brief       Remove the top item from a concurrent stack
+ * @details     Lock-free; safe to call from any number of threads
+ *              concurrently. The removed node is reclaimed once no
+ *              other thread can be reading it anymore, using hazard
+ *              pointers, which also rules out the ABA problem.
+ * @param s     The stack whose top item is going to be removed.
+ * @param item  Where the removed item is stored. Left untouched if \p
+ *              s is empty.
+ * @returns     `true` if an item was removed, `false` if \p s was
+ *              empty.
+ */
+bool cllist__stack_pop (ConcurrentStack * s, void ** item);
+
+
+
+
+/**
+ * @brief       Push an item onto a concurrent stack
+ * @details     Lock-free; safe to call from any number of threads
+ *              concurrently.
+ * @param s     The stack onto which \p item is going to be pushed.
+ * @param item  The item that is going to be pushed onto \p s.
+ */
+void cllist__stack_push (ConcurrentStack * s, void * item);
+
+#endif
@@ -0,0 +1,307 @@
+/**
+ * @file
+ */
+
+
+#ifndef ILLIST_H
+#define ILLIST_H
+#include "llist/llist.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief  Intrusive linked list. Instead of allocating a node per item,
+ *         it links ::llist__Link members that callers embed in their
+ *         own structs, so inserting and removing items never allocates
+ *         memory. A struct with several links can be on several lists
+ *         at once. The API mirrors that of ::LinkedList, with links in
+ *         place of items.
+ *
+ *         @code{.c}
+ *         typedef struct {
+ *             int id;
+ *             llist__Link by_arrival;
+ *             llist__Link by_priority;
+ *         } Task;
+ *
+ *         Task task = { .id = 1 };
+ *         illist__append(arrivals, &task.by_arrival);
+ *         illist__append(priorities, &task.by_priority);
+ *
+ *         llist__Link * link = illist__pop_front(arrivals);
+ *         Task * first = LLIST_CONTAINER_OF(link, Task, by_arrival);
+ *         @endcode
+ *
+ *         The list does not own the structs that contain its links:
+ *         callers keep them alive for as long as they are linked, and a
+ *         link is on at most one list at a time.
+ */
+typedef struct illist IntrusiveList;
+
+/**
+ * @brief  The link that callers embed in their structs to make them
+ *         eligible for an ::IntrusiveList. Its members are managed by
+ *         the list.
+ */
+typedef struct llist__Link {
+    struct llist__Link * next;
+    struct llist__Link * prev;
+} llist__Link;
+
+/**
+ * @brief  Get a pointer to the struct of type \p type that contains
+ *         the ::llist__Link pointed to by \p link as its member \p
+ *         member.
+ */
+#define LLIST_CONTAINER_OF(link, type, member) ((type *) ((char *) (link) - offsetof(type, member)))
+
+
+
+
+/**
+ * @brief       Append a link to an instance of an intrusive linked list
+ * @details     Takes constant time.
+ * @param lst   The instance of an intrusive linked list to which \p
+ *              link is going to be appended.
+ * @param link  The link that is going to be appended to \p lst. It
+ *              must not currently be on any list.
+ */
+void illist__append (IntrusiveList * lst, llist__Link * link);
+
+
+
+
+/**
+ * @brief    Create an instance of an intrusive linked list
+ * @returns  A pointer to the created instance of an intrusive linked
+ *           list.
+ */
+IntrusiveList * illist__create (void);
+
+
+
+
+/**
+ * @brief         Unlink links from an instance of an intrusive linked
+ *                list using a filter function
+ * @details       Behaves like ::llist__delete, except that the unlinked
+ *                links are left to the caller instead of being freed.
+ * @param global  If `true`, all links in \p lst that match according to
+ *                \p filter are unlinked; if `false`, only the first one
+ *                is.
+ * @param lst     The instance of an intrusive linked list from which
+ *                links are going to be unlinked.
+ * @param filter  The function that is used to determine whether
+ *                individual links in \p lst should be unlinked (return
+ *                value `true`) or that they should remain (return value
+ *                `false`).
+ */
+void illist__delete (const bool global, IntrusiveList * lst, bool (*filter)(llist__Link *));
+
+
+
+
+/**
+ * @brief      Destroy an instance of an intrusive linked list
+ * @details    Any links still on \p lst are unlinked. The structs that
+ *             contain them are not touched otherwise.
+ * @param lst  The instance of an intrusive linked list whose memory is
+ *             going to be freed.
+ */
+void illist__destroy (IntrusiveList ** lst);
+
+
+
+
+/**
+ * @brief      Get the first link of an intrusive linked list
+ * @param lst  The intrusive linked list.
+ * @returns    The first link in \p lst, or `NULL` if \p lst is empty.
+ */
+llist__Link * illist__first (const IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief      Get the link at a given position in an intrusive linked
+ *             list
+ * @details    Walks from whichever end of \p lst is closest to \p pos.
+ * @param pos  Zero based pseudo index of the link.
+ * @param lst  The intrusive linked list.
+ * @returns    The link at position \p pos.
+ */
+llist__Link * illist__get (const size_t pos, const IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief      Get the number of links currently in an instance of an
+ *             intrusive linked list
+ * @param lst  The instance of an intrusive linked list whose length is
+ *             being queried.
+ * @returns    The number of links in \p lst.
+ */
+size_t illist__get_length (const IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief       Insert a link at a given position into an intrusive
+ *              linked list.
+ * @param pos   Zero based pseudo index where \p link should be
+ *              inserted into \p lst.
+ * @param link  The link to be inserted. It must not currently be on
+ *              any list.
+ * @param lst   The intrusive linked list into which \p link should be
+ *              inserted.
+ */
+void illist__insert (const size_t pos, llist__Link * link, IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief       Insert a link directly after another link
+ * @details     Takes constant time.
+ * @param lst   The intrusive linked list that \p prev is on.
+ * @param prev  The link after which \p link is inserted, or `NULL` to
+ *              insert \p link at the front of \p lst.
+ * @param link  The link to be inserted. It must not currently be on
+ *              any list.
+ */
+void illist__insert_after (IntrusiveList * lst, llist__Link * prev, llist__Link * link);
+
+
+
+
+/**
+ * @brief      Get the last link of an intrusive linked list
+ * @param lst  The intrusive linked list.
+ * @returns    The last link in \p lst, or `NULL` if \p lst is empty.
+ */
+llist__Link * illist__last (const IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief       Get the link that follows a given link
+ * @details     Together with ::illist__first, this allows walking a
+ *              list without callbacks:
+ *
+ *              @code{.c}
+ *              for (llist__Link * l = illist__first(lst); l != NULL; l = illist__next(l)) {
+ *                  Task * task = LLIST_CONTAINER_OF(l, Task, by_arrival);
+ *                  // ...
+ *              }
+ *              @endcode
+ * @param link  A link that is on a list.
+ * @returns     The next link, or `NULL` if \p link is the last one.
+ */
+llist__Link * illist__next (const llist__Link * link);
+
+
+
+
+/**
+ * @brief      Unlink the last link from an instance of an intrusive
+ *             linked list
+ * @details    Takes constant time. \p lst must not be empty.
+ * @param lst  The instance of an intrusive linked list whose last link
+ *             is going to be unlinked.
+ * @returns    The link that was unlinked from \p lst.
+ */
+llist__Link * illist__pop_back (IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief      Unlink the first link from an instance of an intrusive
+ *             linked list
+ * @details    Takes constant time. \p lst must not be empty.
+ * @param lst  The instance of an intrusive linked list whose first
+ *             link is going to be unlinked.
+ * @returns    The link that was unlinked from \p lst.
+ */
+llist__Link * illist__pop_front (IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief       Prepend a link to an instance of an intrusive linked
+ *              list
+ * @details     Takes constant time.
+ * @param lst   The instance of an intrusive linked list to which \p
+ *              link is going to be prepended.
+ * @param link  The link that is going to be prepended to \p lst. It
+ *              must not currently be on any list.
+ */
+void illist__prepend (IntrusiveList * lst, llist__Link * link);
+
+
+
+
+/**
+ * @brief       Get the link that precedes a given link
+ * @param link  A link that is on a list.
+ * @returns     The previous link, or `NULL` if \p link is the first
+ *              one.
+ */
+llist__Link * illist__prev (const llist__Link * link);
+
+
+
+
+/**
+ * @brief           Print the contents of an instance of an intrusive
+ *                  linked list, optionally using a custom printer
+ *                  function
+ * @details         Behaves like ::llist__print. The element printer
+ *                  receives each ::llist__Link; use
+ *                  ::LLIST_CONTAINER_OF to get to the struct around it.
+ * @param lst       The intrusive linked list whose contents should be
+ *                  printed.
+ * @param printers  The printer function pointers. A default printer
+ *                  function will be substituted for any member that
+ *                  is NULL. If \p printers itself is NULL, all of its
+ *                  printer functions will be substituted with default
+ *                  functions.
+ * @param fd        Where the output should be written. Typically,
+ *                  `stdout`.
+ */
+void illist__print (const IntrusiveList * lst, const llist__Printers * printers, FILE * fd);
+
+
+
+
+/**
+ * @brief      Unlink the link at a given position from an intrusive
+ *             linked list.
+ * @details    Walks from whichever end of \p lst is closest to \p pos.
+ *             Use ::illist__unlink when the link itself is at hand.
+ * @param pos  Zero based pseudo index of the link to unlink.
+ * @param lst  The intrusive linked list.
+ * @returns    The link that was unlinked from \p lst.
+ */
+llist__Link * illist__remove (const size_t pos, IntrusiveList * lst);
+
+
+
+
+/**
+ * @brief       Unlink a given link from the intrusive linked list it
+ *              is on
+ * @details     Takes constant time, since the link knows its
+ *              neighbors.
+ * @param lst   The intrusive linked list that \p link is on.
+ * @param link  The link to unlink.
+ */
+void illist__unlink (IntrusiveList * lst, llist__Link * link);
+
+#endif
@@ -8,11 +8,67 @@
 
 #ifndef LLIST_H
 #define LLIST_H
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 typedef struct llist LinkedList;
 
+/**
+ * @struct llist__NodePool
+ *
+ * @brief  Opaque allocator that hands out linked list nodes from
+ *         contiguous slabs. See ::llist__pool_create.
+ */
+typedef struct llist__node_pool llist__NodePool;
+
+/**
+ * @brief  The number of released nodes that a linked list keeps for
+ *         reuse by default, see ::llist__reserve. Linked lists created
+ *         with an ::llist__Allocator keep none by default.
+ */
+#define LLIST_SPARES 64
+
+/**
+ * @struct llist__Allocator
+ *
+ * @brief  Where a linked list created by ::llist__try_create gets the
+ *         memory for itself and its nodes, e.g. an arena, a region
+ *         backed by huge pages, or a hard-capped budget.
+ */
+typedef struct {
+    /**
+     * @brief  Returns \p size bytes of memory that are suitably aligned
+     *         for any object, or `NULL` if there is none left.
+     */
+    void * (*alloc)(size_t size, void * ctx);
+    /**
+     * @brief  Releases memory \p p of \p size bytes that \p alloc
+     *         returned.
+     */
+    void (*free)(void * p, size_t size, void * ctx);
+    /**
+     * @brief  Passed on to \p alloc and \p free.
+     */
+    void * ctx;
+} llist__Allocator;
+
+/**
+ * @struct llist__Iter
+ *
+ * @brief  Cursor for visiting and editing the items of a linked list
+ *         in a single pass, without allocating. Obtain one with
+ *         ::llist__iter_begin. Its members are private.
+ */
+typedef struct {
+    LinkedList * lst;
+    struct node * curr;
+    bool done;
+} llist__Iter;
+
+
+
+
 /**
  * @struct llist__Printers
  *
@@ -66,12 +122,323 @@ typedef struct {
     void (*post)(FILE * fd, size_t nelems);
 } llist__Printers;
 
+/**
+ * @brief  The built-in payload formatters of ::llist__write.
+ */
+typedef enum {
+    /** Write the payload pointers themselves, as in ::llist__print. */
+    LLIST_FORMAT_POINTER,
+    /** Each payload points to an `int`. */
+    LLIST_FORMAT_INT,
+    /** Each payload points to a `float`. */
+    LLIST_FORMAT_FLOAT,
+    /** Each payload points to a `double`. */
+    LLIST_FORMAT_DOUBLE,
+} llist__Format;
+
+/**
+ * @struct llist__WriteOptions
+ *
+ * @brief  Options for ::llist__write. Zero-initialized members select
+ *         the defaults: text output of the payload pointers through an
+ *         internal buffer.
+ */
+typedef struct {
+    /**
+     * @brief  Which built-in formatter to use for the payloads. Ignored
+     *         if \p elem is set.
+     */
+    llist__Format format;
+    /**
+     * @brief  The number of digits after the decimal point for
+     *         ::LLIST_FORMAT_FLOAT and ::LLIST_FORMAT_DOUBLE, as in
+     *         `%.*f`. At most 17.
+     */
+    unsigned int precision;
+    /**
+     * @brief  If `true`, write a compact binary representation instead
+     *         of text: the number of items as a `uint64_t`, followed by
+     *         the raw bytes of each payload (the `int`, `float`,
+     *         `double`, or pointer itself) in native byte order.
+     */
+    bool binary;
+    /**
+     * @brief  Optional buffer to format into. If `NULL`, an internal
+     *         buffer of 256 KiB is used.
+     */
+    char * buffer;
+    /**
+     * @brief  The size of \p buffer in bytes.
+     */
+    size_t bufsize;
+    /**
+     * @brief  Optional custom formatter. It writes the representation
+     *         of payload \p p into \p buf, which has room for \p
+     *         avail bytes, and returns the number of bytes it needs,
+     *         like `snprintf` does. If that number is not less than \p
+     *         avail, the buffer is flushed and \p elem is called again;
+     *         if the item doesn't fit an empty buffer either, it is
+     *         formatted into a temporary buffer of the size asked for
+     *         and written from there. The separators between items are
+     *         written by ::llist__write in text mode, and not at all in
+     *         binary mode.
+     */
+    size_t (*elem)(char * buf, size_t avail, const void * p);
+} llist__WriteOptions;
+
+/**
+ * @struct llist__Codec
+ *
+ * @brief  Describes how ::llist__save stores payloads. A loaded list's
+ *         payloads point straight at the stored bytes, so the encoding
+ *         should be the in-memory representation that users of the
+ *         loaded list expect.
+ */
+typedef struct {
+    /**
+     * @brief  Returns the number of bytes that payload \p p takes.
+     */
+    size_t (*size)(const void * p, void * ctx);
+    /**
+     * @brief  Optional. Writes the bytes of payload \p p to \p dst,
+     *         which has room for `size(p, ctx)` bytes. If `NULL`, that
+     *         many bytes are copied from \p p.
+     */
+    void (*encode)(void * dst, const void * p, void * ctx);
+    /**
+     * @brief  Passed on to \p size and \p encode.
+     */
+    void * ctx;
+} llist__Codec;
+
+/**
+ * @struct llist__Reducer
+ *
+ * @brief  Describes a reduction for ::llist__reduce in terms of an
+ *         accumulator of \p size bytes.
+ */
+typedef struct {
+    /**
+     * @brief  The size of the accumulator in bytes.
+     */
+    size_t size;
+    /**
+     * @brief  Folds \p item into accumulator \p acc.
+     */
+    void (*step)(void * acc, void * item, void * ctx);
+    /**
+     * @brief  Folds accumulator \p other, which holds the result for
+     *         items that come after those of \p acc, into \p acc. Must
+     *         be associative.
+     */
+    void (*combine)(void * acc, const void * other, void * ctx);
+    /**
+     * @brief  Passed on to \p step and \p combine.
+     */
+    void * ctx;
+} llist__Reducer;
+
+/**
+ * @brief  The number of buckets in the latency histograms of
+ *         ::llist__OpStats.
+ */
+#define LLIST_STATS_NBUCKETS 32
+
+/**
+ * @brief  The groups of operations that ::llist__stats keeps apart.
+ */
+typedef enum {
+    /** ::llist__insert and ::llist__try_insert, and the functions built
+     *  on them such as ::llist__append, as well as
+     *  ::llist__insert_sorted. */
+    LLIST_STATS_INSERT,
+    /** ::llist__get. */
+    LLIST_STATS_GET,
+    /** ::llist__remove, ::llist__pop_front and ::llist__pop_back. */
+    LLIST_STATS_REMOVE,
+    /** ::llist__delete, ::llist__delete_ctx, ::llist__partition,
+     *  ::llist__delete_key and ::llist__delete_where. */
+    LLIST_STATS_DELETE,
+    /** ::llist__find, ::llist__contains and ::llist__move_to_front. */
+    LLIST_STATS_FIND,
+    /** The number of groups. */
+    LLIST_STATS_NOPS,
+} llist__StatsOp;
+
+/**
+ * @struct llist__OpStats
+ *
+ * @brief  What ::llist__stats knows about one group of operations.
+ */
+typedef struct {
+    /**
+     * @brief  The number of calls.
+     */
+    uint64_t count;
+    /**
+     * @brief  The number of nodes that the calls visited, including
+     *         lanes of the index and nodes visited while rebuilding the
+     *         index or keyed index. A ratio of nodes to calls that
+     *         grows with the length of the list points to an O(n) call
+     *         in a loop.
+     */
+    uint64_t nodes;
+    /**
+     * @brief  Histogram of the time the calls took: bucket `b` counts
+     *         calls of less than `2^(b + 1)` nanoseconds and, except for
+     *         the first bucket, at least `2^b` nanoseconds. The last
+     *         bucket also counts anything slower.
+     */
+    uint64_t latency[LLIST_STATS_NBUCKETS];
+} llist__OpStats;
+
+/**
+ * @struct llist__Stats
+ *
+ * @brief  Operation counters of a linked list, or of all linked lists
+ *         together. See ::llist__stats.
+ */
+typedef struct {
+    /**
+     * @brief  Per group of operations, indexed by ::llist__StatsOp.
+     */
+    llist__OpStats ops[LLIST_STATS_NOPS];
+    /**
+     * @brief  The number of nodes allocated, from `malloc`, a pool, or
+     *         an ::llist__Allocator.
+     */
+    uint64_t nallocs;
+    /**
+     * @brief  The number of nodes released.
+     */
+    uint64_t nfrees;
+} llist__Stats;
+
+/**
+ * @struct llist__Locality
+ *
+ * @brief  How close together the nodes of a linked list were before and
+ *         after ::llist__compact, each as returned by ::llist__locality.
+ */
+typedef struct {
+    double before;
+    double after;
+} llist__Locality;
+
+/**
+ * @brief  The type of the payload field that an ::llist__Where tests.
+ */
+typedef enum {
+    /** The field is an `int`. */
+    LLIST_FIELD_INT,
+    /** The field is a `float`. */
+    LLIST_FIELD_FLOAT,
+} llist__FieldType;
+
+/**
+ * @brief  The comparison that an ::llist__Where makes, with `x` the
+ *         payload field.
+ */
+typedef enum {
+    /** `x == value` */
+    LLIST_WHERE_EQ,
+    /** `x < value` */
+    LLIST_WHERE_LT,
+    /** `x > value` */
+    LLIST_WHERE_GT,
+    /** `value <= x && x <= upper` */
+    LLIST_WHERE_RANGE,
+    /** `x` equals one of `set[0]` to `set[nset - 1]` */
+    LLIST_WHERE_IN,
+} llist__WhereOp;
+
+/**
+ * @brief  A constant of the type that an ::llist__Where tests; use the
+ *         member that matches its `type`.
+ */
+typedef union {
+    int i;
+    float f;
+} llist__Scalar;
+
+/**
+ * @struct llist__Where
+ *
+ * @brief  A built-in predicate on a numeric field of every payload, see
+ *         ::llist__delete_where. Float comparisons follow IEEE 754, so a
+ *         NaN field matches nothing.
+ */
+typedef struct {
+    /**
+     * @brief  The type of the field.
+     */
+    llist__FieldType type;
+    /**
+     * @brief  The offset of the field within each payload, e.g. from
+     *         `offsetof`. 0 for payloads that point to a bare number.
+     */
+    size_t offset;
+    /**
+     * @brief  The comparison.
+     */
+    llist__WhereOp op;
+    /**
+     * @brief  The value to compare with, or the lower bound of a range.
+     */
+    llist__Scalar value;
+    /**
+     * @brief  The upper bound of a range. Unused by other comparisons.
+     */
+    llist__Scalar upper;
+    /**
+     * @brief  The values that ::LLIST_WHERE_IN looks for. Unused by
+     *         other comparisons.
+     */
+    const llist__Scalar * set;
+    /**
+     * @brief  The number of values in `set`.
+     */
+    size_t nset;
+} llist__Where;
+
+/**
+ * @struct llist__KeyOps
+ *
+ * @brief  Describes the keys of a keyed linked list, see
+ *         ::llist__set_keyed. Keys must be unique within a linked list,
+ *         and the key of an item must not change while the item is in
+ *         a keyed linked list.
+ */
+typedef struct {
+    /**
+     * @brief  Optional. Returns the key of \p item. If `NULL`, every
+     *         item is its own key.
+     */
+    const void * (*key)(const void * item, void * ctx);
+    /**
+     * @brief  Returns the hash of \p key. Keys that are equal must have
+     *         equal hashes.
+     */
+    uint64_t (*hash)(const void * key, void * ctx);
+    /**
+     * @brief  Returns whether keys \p a and \p b are equal.
+     */
+    bool (*equal)(const void * a, const void * b, void * ctx);
+    /**
+     * @brief  Passed on to \p key, \p hash and \p equal.
+     */
+    void * ctx;
+} llist__KeyOps;
+
 
 
 
 /**
  * @brief       Append an item to an instance of a linked list
- * @details
+ * @details     The linked list keeps track of its last node, so
+ *              appending takes constant time regardless of the length
+ *              of \p lst, or O(log n) time if \p lst is indexed (see
+ *              ::llist__set_indexed).
  * @param lst   The instance of a linked list to which \p item is
  *              going to be appended.
  * @param item  The item that is going to be appended to \p lst.
@@ -81,8 +448,82 @@ void llist__append (LinkedList * lst, void * item);
 
 
 
+/**
+ * @brief        Append an array of items to an instance of a linked
+ *               list
+ * @details      The new nodes are allocated and linked to each other in
+ *               a single pass, and then attached to the end of \p lst
+ *               in constant time.
+ * @param lst    The instance of a linked list to which the items are
+ *               going to be appended.
+ * @param items  The items that are going to be appended to \p lst, in
+ *               order.
+ * @param n      The number of items in \p items.
+ */
+void llist__append_array (LinkedList * lst, void ** items, const size_t n);
+
+
+
+
+/**
+ * @brief      Move the nodes of a linked list next to each other in list
+ *             order
+ * @details
+ * After long runs of insertions and deletions, consecutive nodes tend
+ * to end up far apart in memory, which makes traversing the list much
+ * slower than traversing a freshly built one. Compacting copies the
+ * nodes in list order into a single block of memory of their own,
+ * which restores array-like traversal, and then returns the old nodes
+ * to their pool or allocator. The block comes from the allocator of \p
+ * lst. A linked list that draws its nodes from a pool falls back to
+ * `malloc` for the block, which is not part of the pool and so isn't
+ * freed by ::llist__pool_destroy; like any block, it is freed once none
+ * of its nodes is in use, or else when the last linked list holding
+ * them is destroyed. Nodes that are later deleted go back to the block
+ * and are reused by later insertions. Memory use peaks at twice that
+ * of the nodes. Takes linear time, and does nothing if the nodes are
+ * already adjacent. Spare nodes (see ::llist__reserve) are released
+ * first rather than reused, as they are as scattered as the rest.
+ *
+ * Compacting is only an optimization: if the block can't be allocated,
+ * \p lst is left as it was, `errno` is set to `ENOMEM`, and the
+ * locality after equals the locality before.
+ *
+ * Lists that take over nodes of \p lst, e.g. with ::llist__splice,
+ * share its block, and like lists that share a pool must not be used
+ * from different threads at the same time.
+ *
+ * Items don't move and keep their positions. Cursors obtained with
+ * ::llist__iter_begin become invalid, and indexes are rebuilt on their
+ * next use.
+ * @param lst  The linked list.
+ * @returns    The locality of \p lst before and after compacting.
+ */
+llist__Locality llist__compact (LinkedList * lst);
+
+
+
+
+/**
+ * @brief      Check whether a keyed linked list holds an item with a
+ *             given key
+ * @details    Takes expected constant time. \p lst must be keyed, see
+ *             ::llist__set_keyed.
+ * @param lst  The keyed linked list.
+ * @param key  The key to look for.
+ * @returns    `true` if \p lst holds an item whose key equals \p key,
+ *             `false` otherwise.
+ */
+bool llist__contains (LinkedList * lst, const void * key);
+
+
+
+
 /**
  * @brief    Create an instance of a linked list
+ * @details  Terminates the program if memory runs out, like all
+ *           functions that add items do. See ::llist__try_create for
+ *           a linked list that reports running out of memory instead.
  * @returns  A pointer to the created instance of a linked list.
  */
 LinkedList * llist__create (void);
@@ -90,6 +531,32 @@ LinkedList * llist__create (void);
 
 
 
+/**
+ * @brief       Create an instance of a linked list whose nodes are
+ *              drawn from a node pool
+ * @details
+ * Nodes are taken from contiguous slabs owned by \p pool instead of
+ * being allocated one by one with `malloc`. Nodes released by the
+ * linked list are kept on the pool's freelist for reuse, and
+ * ::llist__destroy returns all nodes of the linked list to the pool in
+ * constant time. Any number of linked lists may share a single pool,
+ * but a pool is not thread safe.
+ *\code{.c}
+ *     llist__NodePool * pool = llist__pool_create(4096);
+ *     LinkedList * lst = llist__create_with_pool(pool);
+ *     // ... use lst as usual ...
+ *     llist__destroy(&lst);
+ *     llist__pool_destroy(&pool);
+ *\endcode
+ * @param pool  The node pool that provides the nodes. It must outlive
+ *              the linked list.
+ * @returns     A pointer to the created instance of a linked list.
+ */
+LinkedList * llist__create_with_pool (llist__NodePool * pool);
+
+
+
+
 /**
  * @brief         Delete an item from an instance of a linked list
  *                using a filter function
@@ -122,6 +589,11 @@ LinkedList * llist__create (void);
  *    [0x7fff246a58b0, 0x7fff246a58b4, 0x7fff246a58b8, 0x7fff246a58bc]
  *    [0x7fff246a58b4, 0x7fff246a58bc]
  *\endcode
+ *
+ * If \p lst is indexed (see ::llist__set_indexed), deleting only the
+ * first matching item keeps the index up to date, and deleting nothing
+ * leaves it as is; any other deletion has the index rebuilt on its
+ * next use.
  *     
  * @param global  If `true`, the deletion is applied globally, i.e. to
  *                all items in \p lst that match according to \p
@@ -142,6 +614,96 @@ void llist__delete (const bool global, LinkedList * lst, bool (*filter)(void *))
 
 
 
+/**
+ * @brief          Delete items from an instance of a linked list using
+ *                 a predicate that carries user data
+ * @details
+ * Unlike ::llist__delete, \p pred receives a user supplied context
+ * pointer, so that parameterized predicates don't need global state.
+ * The deleted items can optionally be handed back by relinking their
+ * nodes into another linked list, which avoids freeing and reallocating
+ * the nodes.
+ *\code{.c}
+ *     static bool is_multiple_of (void * p, void * ctx) {
+ *         return *((int *) p) % *((int *) ctx) == 0;
+ *     }
+ *
+ *     int divisor = 3;
+ *     LinkedList * removed = llist__create();
+ *     size_t n = llist__delete_ctx(lst, is_multiple_of, &divisor, SIZE_MAX, removed);
+ *\endcode
+ * @param lst      The instance of a linked list from which items are
+ *                 going to be deleted.
+ * @param pred     The function that is used to determine whether
+ *                 individual items in \p lst qualify for deletion
+ *                 (return value `true`) or that they should remain
+ *                 (return value `false`). Its first argument is the
+ *                 item, its second argument is \p ctx.
+ * @param ctx      User data that is passed on to \p pred.
+ * @param limit    The maximum number of items to delete. Pass
+ *                 `SIZE_MAX` to delete all matching items.
+ * @param removed  If not NULL, the deleted items are appended to this
+ *                 linked list, in their original order, instead of
+ *                 being dropped. It must draw its nodes from the same
+ *                 pool as \p lst, or both from none.
+ * @returns        The number of items that were deleted.
+ */
+size_t llist__delete_ctx (LinkedList * lst, bool (*pred)(void *, void *), void * ctx, const size_t limit,
+                          LinkedList * removed);
+
+
+
+
+/**
+ * @brief      Delete the item with a given key from a keyed linked list
+ * @details    Takes expected constant time, whereas ::llist__delete
+ *             visits every node up to the match. \p lst must be keyed,
+ *             see ::llist__set_keyed. If \p lst is also indexed, its
+ *             index is marked as stale.
+ * @param lst  The keyed linked list.
+ * @param key  The key of the item to delete.
+ * @returns    The deleted item, or `NULL` if \p lst holds no item whose
+ *             key equals \p key.
+ */
+void * llist__delete_key (LinkedList * lst, const void * key);
+
+
+
+
+/**
+ * @brief        Delete all items whose payload field satisfies a
+ *               built-in predicate
+ * @details
+ * Like ::llist__delete with a filter that compares a numeric field of
+ * each payload, but without calling a function per item. The fields of
+ * a batch of items are gathered into an array, the predicate is
+ * evaluated over the whole batch with SIMD instructions, and the
+ * resulting bitmask drives the unlinking of the matching nodes. The
+ * widest instruction set the CPU supports is picked at run time: AVX2
+ * or SSE2 on x86, otherwise plain C.
+ *\code{.c}
+ *     typedef struct {
+ *         int id;
+ *         float price;
+ *     } Order;
+ *
+ *     llist__Where cheap = {
+ *         .type = LLIST_FIELD_FLOAT,
+ *         .offset = offsetof(Order, price),
+ *         .op = LLIST_WHERE_LT,
+ *         .value = { .f = 10.0f },
+ *     };
+ *     size_t n = llist__delete_where(lst, &cheap);
+ *\endcode
+ * @param lst    The linked list.
+ * @param where  The predicate.
+ * @returns      The number of deleted items.
+ */
+size_t llist__delete_where (LinkedList * lst, const llist__Where * where);
+
+
+
+
 /**
  * @brief      Destroy an instance of a linked list
  * @details
@@ -153,9 +715,41 @@ void llist__destroy (LinkedList ** lst);
 
 
 
+/**
+ * @brief      Move all items of one linked list to the end of another
+ * @details    Same as ::llist__splice at the end of \p dst, which takes
+ *             constant time. Both linked lists must draw their nodes
+ *             from the same pool and allocator, or else the program
+ *             terminates. Afterwards, \p src is empty.
+ * @param dst  The linked list to which the items are appended.
+ * @param src  The linked list whose items are moved.
+ */
+void llist__extend (LinkedList * dst, LinkedList * src);
+
+
+
+
+/**
+ * @brief      Find the item with a given key in a keyed linked list
+ * @details    Takes expected constant time. \p lst must be keyed, see
+ *             ::llist__set_keyed.
+ * @param lst  The keyed linked list.
+ * @param key  The key to look for.
+ * @returns    The item whose key equals \p key, or `NULL` if there is
+ *             none.
+ */
+void * llist__find (LinkedList * lst, const void * key);
+
+
+
+
 /**
  * @brief       Insert an item at a given position into a linked list.
- * @details
+ * @details     Nodes are doubly linked, so the position is found by
+ *              walking from whichever end of \p lst is closest to \p
+ *              pos. Inserting at either end takes constant time. If
+ *              \p lst is indexed (see ::llist__set_indexed), inserting
+ *              takes O(log n) time at any position.
  * @param pos   Zero based pseudo index where \p item should be
  *              inserted into \p lst.
  * @param item  The item to be inserted.
@@ -166,6 +760,42 @@ void llist__insert (const size_t pos, void * item, LinkedList * lst);
 
 
 
+/**
+ * @brief       Insert an item into a sorted linked list, keeping it
+ *              sorted
+ * @details     \p item is inserted after any items that compare equal
+ *              to it. Appending takes constant time, so building a
+ *              sorted linked list from items that arrive in order is
+ *              cheap; otherwise the position is found by walking from
+ *              the start of \p lst.
+ * @param lst   The sorted linked list into which \p item should be
+ *              inserted.
+ * @param item  The item to be inserted.
+ * @param cmp   Comparison function with the same semantics as the one
+ *              passed to ::llist__sort.
+ * @param ctx   User data that is passed on to \p cmp.
+ * @returns     The zero based position at which \p item was inserted.
+ */
+size_t llist__insert_sorted (LinkedList * lst, void * item, int (*cmp)(const void *, const void *, void *),
+                             void * ctx);
+
+
+
+
+/**
+ * @brief       Get the item at a given position in a linked list.
+ * @details     Takes O(log n) time if \p lst is indexed (see
+ *              ::llist__set_indexed), otherwise walks from whichever end
+ *              of \p lst is closest to \p pos.
+ * @param pos   Zero based index of the item in \p lst.
+ * @param lst   The linked list that holds the item.
+ * @returns     The item at position \p pos.
+ */
+void * llist__get (const size_t pos, LinkedList * lst);
+
+
+
+
 /**
  * @brief      Get the number of items currently stored in an instance
  *             of a linked list
@@ -179,6 +809,310 @@ size_t llist__get_length (const LinkedList * lst);
 
 
 
+/**
+ * @brief      Create a cursor for a linked list
+ * @details
+ * The cursor starts out positioned before the first item, so the first
+ * call to ::llist__iter_next moves it onto the first item. Edits made
+ * through the cursor take constant time each, so a pass that makes k
+ * edits to a linked list of n items costs O(n + k) in total.
+ *\code{.c}
+ *     llist__Iter it = llist__iter_begin(lst);
+ *     while (llist__iter_next(&it)) {
+ *         int * p = llist__iter_get(&it);
+ *         if (*p % 2 == 0) {
+ *             llist__iter_remove_here(&it);
+ *         } else {
+ *             llist__iter_insert_after(&it, (void *) p);
+ *         }
+ *     }
+ *\endcode
+ * The linked list must not be modified other than through the cursor
+ * for as long as the cursor is in use.
+ * @param lst  The linked list that is going to be visited.
+ * @returns    A cursor positioned before the first item of \p lst.
+ */
+llist__Iter llist__iter_begin (LinkedList * lst);
+
+
+
+
+/**
+ * @brief      Get the item under a cursor
+ * @details    The cursor must be positioned on an item, i.e. the last
+ *             call to ::llist__iter_next must have returned `true`.
+ * @param it   The cursor.
+ * @returns    The item under \p it.
+ */
+void * llist__iter_get (const llist__Iter * it);
+
+
+
+
+/**
+ * @brief       Insert an item after the item under a cursor
+ * @details     If the cursor is positioned before the first item, \p
+ *              item is prepended. Afterwards, the cursor is positioned
+ *              on \p item, such that the next call to
+ *              ::llist__iter_next continues with the item that
+ *              originally followed the cursor.
+ * @param it    The cursor.
+ * @param item  The item to be inserted.
+ */
+void llist__iter_insert_after (llist__Iter * it, void * item);
+
+
+
+
+/**
+ * @brief      Move a cursor to the next item
+ * @details
+ * @param it   The cursor.
+ * @returns    `true` if the cursor moved onto an item, `false` if
+ *             there were no items left.
+ */
+bool llist__iter_next (llist__Iter * it);
+
+
+
+
+/**
+ * @brief      Remove the item under a cursor
+ * @details    Afterwards, the cursor is positioned on the item that
+ *             preceded the removed item (or before the first item),
+ *             such that the next call to ::llist__iter_next continues
+ *             with the item that followed the removed item.
+ * @param it   The cursor.
+ * @returns    The item that was removed.
+ */
+void * llist__iter_remove_here (llist__Iter * it);
+
+
+
+
+/**
+ * @brief       Load a linked list from a snapshot written by
+ *              ::llist__save
+ * @details     Maps the file into memory and turns the stored node
+ *              records into the nodes of the returned list in a single
+ *              pass over them, without allocating per item. The
+ *              payloads are not copied: each one points at its stored
+ *              bytes inside the mapping, which stays alive until the
+ *              list is destroyed. Such payloads may be modified but
+ *              must not be freed, and changes to them are not written
+ *              back to the file.
+ *
+ *              The returned list behaves like any other. Its nodes come
+ *              from a pool of its own, which is why ::llist__splice
+ *              and friends don't accept it together with lists that
+ *              use a different pool.
+ * @param path  The snapshot file.
+ * @returns     The loaded list, or `NULL` if the file can't be opened
+ *              or mapped, in which case `errno` says why. `errno` is
+ *              `EINVAL` if the file is not a snapshot, or was written
+ *              on a platform with a different pointer size or byte
+ *              order.
+ */
+LinkedList * llist__load_mmap (const char * path);
+
+
+
+
+/**
+ * @brief      Measure how close together the nodes of a linked list are
+ * @details    Takes linear time. Useful for deciding when a long-lived
+ *             linked list is worth compacting, see ::llist__compact.
+ * @param lst  The linked list.
+ * @returns    The fraction of nodes with a successor, between 0 and 1,
+ *             whose successor starts less than a cache line further on
+ *             in memory. Linked lists of fewer than two items count as
+ *             1.
+ */
+double llist__locality (const LinkedList * lst);
+
+
+
+
+/**
+ * @brief       Move the items that match a predicate from one linked
+ *              list to another
+ * @details     Single pass equivalent of ::llist__delete_ctx with an
+ *              unlimited \p limit. Nodes are relinked, not reallocated.
+ *              Both linked lists retain the relative order of their
+ *              items.
+ * @param lst   The linked list whose matching items are moved.
+ * @param pred  The function that is used to determine whether
+ *              individual items in \p lst should be moved (return value
+ *              `true`) or that they should remain (return value
+ *              `false`). Its first argument is the item, its second
+ *              argument is \p ctx.
+ * @param ctx   User data that is passed on to \p pred.
+ * @param dst   The linked list to which the matching items are
+ *              appended. It must draw its nodes from the same pool and
+ *              allocator as \p lst, or else the program terminates.
+ * @returns     The number of items that were moved.
+ */
+size_t llist__partition (LinkedList * lst, bool (*pred)(void *, void *), void * ctx, LinkedList * dst);
+
+
+
+
+/**
+ * @brief       Merge sorted linked lists into one
+ * @details     All of \p dst and \p srcs must already be sorted
+ *              according to \p cmp. Their nodes are relinked into \p
+ *              dst in O(n log k) time without allocating; afterwards
+ *              every list in \p srcs is empty. The merge is stable:
+ *              items that compare equal keep the order of \p dst, \p
+ *              srcs[0], \p srcs[1], and so on. All linked lists must
+ *              draw their nodes from the same pool and allocator, or
+ *              else the program terminates.
+ * @param dst   The sorted linked list that receives all items.
+ * @param srcs  The sorted linked lists whose items are moved into \p
+ *              dst.
+ * @param k     The number of linked lists in \p srcs.
+ * @param cmp   Comparison function with the same semantics as the one
+ *              passed to ::llist__sort.
+ * @param ctx   User data that is passed on to \p cmp.
+ */
+void llist__merge (LinkedList * dst, LinkedList ** srcs, const size_t k, int (*cmp)(const void *, const void *, void *),
+                   void * ctx);
+
+
+
+
+/**
+ * @brief      Move the item with a given key to the front of a keyed
+ *             linked list
+ * @details    Takes expected constant time. Together with
+ *             ::llist__pop_back, this is the bookkeeping of a least
+ *             recently used cache:
+ *
+ *             @code{.c}
+ *             if (llist__move_to_front(lst, &key) == NULL) {
+ *                 if (llist__get_length(lst) == capacity) {
+ *                     evict(llist__pop_back(lst));
+ *                 }
+ *                 llist__prepend(lst, load(&key));
+ *             }
+ *             @endcode
+ *
+ *             \p lst must be keyed, see ::llist__set_keyed. If \p lst
+ *             is also indexed, its index is marked as stale.
+ * @param lst  The keyed linked list.
+ * @param key  The key of the item to move.
+ * @returns    The moved item, or `NULL` if \p lst holds no item whose
+ *             key equals \p key.
+ */
+void * llist__move_to_front (LinkedList * lst, const void * key);
+
+
+
+
+/**
+ * @brief                 Create a node pool
+ * @details               Slabs are allocated lazily, one at a time,
+ *                        whenever the pool has no free nodes left.
+ *                        They always come from `malloc`: linked lists
+ *                        that use a pool have no ::llist__Allocator.
+ * @param nodes_per_slab  The number of nodes in each slab. Must be
+ *                        larger than zero.
+ * @returns               A pointer to the created node pool.
+ */
+llist__NodePool * llist__pool_create (const size_t nodes_per_slab);
+
+
+
+
+/**
+ * @brief           Delete the items of a linked list that match a
+ *                  predicate, evaluating the predicate on several
+ *                  threads
+ * @details         Like ::llist__delete_ctx without a limit, but meant
+ *                  for predicates that are expensive enough to be
+ *                  worth spreading over threads. The list is divided
+ *                  into segments (see ::llist__parallel_for_each),
+ *                  each thread evaluates \p pred for the items of the
+ *                  segments it takes, and the calling thread then
+ *                  unlinks the matches in a single pass. \p pred must
+ *                  be safe to call concurrently.
+ * @param lst       The linked list to delete items from.
+ * @param pred      Returns `true` for items that should be deleted.
+ * @param ctx       Passed on to \p pred.
+ * @param nthreads  The number of threads to use, including the calling
+ *                  thread, or 0 for one per online processor.
+ * @returns         The number of deleted items.
+ */
+size_t llist__parallel_filter (LinkedList * lst, bool (*pred)(void *, void *), void * ctx, size_t nthreads);
+
+
+
+
+/**
+ * @brief           Call a function for every item of a linked list, on
+ *                  several threads
+ * @details         The list is divided into segments of consecutive
+ *                  items, which threads take one at a time until none
+ *                  are left, so uneven costs per item balance out. The
+ *                  segmentation depends only on the length of the list
+ *                  and is cached until the list changes, after which
+ *                  the next parallel call redoes it in one walk.
+ *
+ *                  \p fn is called exactly once per item, in order
+ *                  within a segment, but segments are processed
+ *                  concurrently. It may modify the item it receives,
+ *                  but must not modify \p lst.
+ * @param lst       The linked list.
+ * @param fn        The function to call for each item.
+ * @param ctx       Passed on to \p fn.
+ * @param nthreads  The number of threads to use, including the calling
+ *                  thread, or 0 for one per online processor.
+ */
+void llist__parallel_for_each (LinkedList * lst, void (*fn)(void *, void *), void * ctx, size_t nthreads);
+
+
+
+
+/**
+ * @brief       Destroy a node pool
+ * @details     Frees all of the pool's slabs at once. Every linked list
+ *              that was created with \p pool must have been destroyed
+ *              beforehand.
+ * @param pool  The node pool whose memory is going to be freed.
+ */
+void llist__pool_destroy (llist__NodePool ** pool);
+
+
+
+
+/**
+ * @brief      Remove the last item from an instance of a linked list
+ * @details    Takes constant time, or O(log n) time if \p lst is
+ *             indexed (see ::llist__set_indexed). \p lst must not be
+ *             empty.
+ * @param lst  The instance of a linked list whose last item is going
+ *             to be removed.
+ * @returns    The item that was removed from \p lst.
+ */
+void * llist__pop_back (LinkedList * lst);
+
+
+
+
+/**
+ * @brief      Remove the first item from an instance of a linked list
+ * @details    Takes constant time, or O(log n) time if \p lst is
+ *             indexed (see ::llist__set_indexed). \p lst must not be
+ *             empty.
+ * @param lst  The instance of a linked list whose first item is going
+ *             to be removed.
+ * @returns    The item that was removed from \p lst.
+ */
+void * llist__pop_front (LinkedList * lst);
+
+
+
+
 /**
  * @brief       Prepend an item to an instance of a linked list
  * @details
@@ -191,6 +1125,46 @@ void llist__prepend (LinkedList * lst, void * item);
 
 
 
+/**
+ * @brief           Reduce the items of a linked list to a single value,
+ *                  on several threads
+ * @details         Every segment of the list (see
+ *                  ::llist__parallel_for_each) is folded into its own
+ *                  copy of the initial accumulator using \p
+ *                  reducer->step, after which the partial results are
+ *                  combined into \p acc from the first segment to the
+ *                  last. Since the segmentation depends only on the
+ *                  length of the list, the result does not depend on
+ *                  \p nthreads, even for operations that are only
+ *                  approximately associative such as floating point
+ *                  addition.
+ *
+ *                  @code{.c}
+ *                  static void add (void * acc, void * item, void *) {
+ *                      *((double *) acc) += *((double *) item);
+ *                  }
+ *
+ *                  static void add_partial (void * acc, const void * other, void *) {
+ *                      *((double *) acc) += *((const double *) other);
+ *                  }
+ *
+ *                  llist__Reducer sum = { .size = sizeof(double), .step = add, .combine = add_partial };
+ *                  double total = 0.0;
+ *                  llist__reduce(lst, &sum, &total, 0);
+ *                  @endcode
+ * @param lst       The linked list.
+ * @param reducer   The reduction. See ::llist__Reducer.
+ * @param acc       On input, the initial accumulator, which must be an
+ *                  identity for \p reducer->combine; on output, the
+ *                  result.
+ * @param nthreads  The number of threads to use, including the calling
+ *                  thread, or 0 for one per online processor.
+ */
+void llist__reduce (LinkedList * lst, const llist__Reducer * reducer, void * acc, size_t nthreads);
+
+
+
+
 /**
  * @brief           Print the contents of an instance of a linked
  *                  list, optionally using a custom printer function
@@ -290,7 +1264,499 @@ void llist__prepend (LinkedList * lst, void * item);
  *                  functions.
  * @param fd        Where the output should be written. Typically,
  *                  `stdout`.
+ * @see             ::llist__write for dumping large lists.
  */
 void llist__print (const LinkedList * lst, const llist__Printers * printers, FILE * fd);
 
+
+
+
+
+/**
+ * @brief       Remove the item at a given position from a linked list.
+ * @details     Takes O(log n) time if \p lst is indexed (see
+ *              ::llist__set_indexed), otherwise walks from whichever end
+ *              of \p lst is closest to \p pos.
+ * @param pos   Zero based index of the item that should be removed
+ *              from \p lst.
+ * @param lst   The linked list from which the item is removed.
+ * @returns     The item that was removed from \p lst.
+ */
+void * llist__remove (const size_t pos, LinkedList * lst);
+
+
+
+
+/**
+ * @brief      Set aside nodes for a linked list to grow into
+ * @details
+ * A linked list keeps the nodes of items it deletes, pops or removes
+ * on a stack of spare nodes, and takes nodes from that stack before it
+ * asks `malloc`, its pool or its ::llist__Allocator for new ones. That
+ * way, a workload that keeps the length of a list steady, such as a
+ * queue that pops at the front and appends at the back, stops calling
+ * the allocator once it is warmed up. The stack holds up to
+ * ::LLIST_SPARES nodes by default; nodes released while it is full are
+ * freed right away. Linked lists created with an ::llist__Allocator
+ * (see ::llist__try_create) keep no spare nodes until they reserve
+ * some, as spare nodes are lost to other linked lists that share the
+ * same budget.
+ *
+ * Reserving allocates spare nodes until \p lst can hold \p n items
+ * without allocating, and raises the number of spare nodes \p lst keeps
+ * to at least \p n, so that the reserved nodes stay around after the
+ * list shrinks again. Spare nodes are released by
+ * ::llist__shrink_to_fit and ::llist__destroy.
+ *
+ *         @code{.c}
+ *         llist__reserve(queue, 1024);
+ *         while (running) {
+ *             // neither allocates, as long as the queue stays below 1024 items
+ *             llist__append(queue, produce());
+ *             consume(llist__pop_front(queue));
+ *         }
+ *         @endcode
+ * @param lst  The linked list.
+ * @param n    The number of items \p lst should be able to hold without
+ *             allocating.
+ */
+void llist__reserve (LinkedList * lst, const size_t n);
+
+
+
+
+/**
+ * @brief        Write a snapshot of a linked list that
+ *               ::llist__load_mmap can load
+ * @details      The snapshot is a header, followed by one contiguous
+ *               array of node records and then the payload bytes.
+ *               Each record holds the file offsets of its payload and
+ *               of its neighbors, so the records can be walked right
+ *               in the mapped file. Output goes through the buffered
+ *               writer of ::llist__write.
+ *
+ *               @code{.c}
+ *               static size_t int_size (const void *, void *) {
+ *                   return sizeof(int);
+ *               }
+ *
+ *               llist__Codec codec = { .size = int_size };
+ *               llist__save(lst, fd, &codec);
+ *               @endcode
+ * @param lst    The linked list to save.
+ * @param fd     The file descriptor to write to.
+ * @param codec  How to store the payloads. If `NULL`, the payload
+ *               pointers themselves are stored, which is only useful
+ *               for payloads that aren't really pointers, e.g. small
+ *               integers cast to `void *`.
+ * @returns      `true` if the whole snapshot was written, `false` if
+ *               `write` failed, in which case `errno` says why.
+ */
+bool llist__save (const LinkedList * lst, int fd, const llist__Codec * codec);
+
+
+
+
+/**
+ * @brief       Sort a linked list
+ * @details
+ * Stable, bottom-up merge sort that relinks the existing nodes in
+ * O(n log n) time without allocating any memory.
+ *\code{.c}
+ *     static int by_value (const void * a, const void * b, void *) {
+ *         int x = *((const int *) a);
+ *         int y = *((const int *) b);
+ *         return (x > y) - (x < y);
+ *     }
+ *
+ *     llist__sort(lst, by_value, NULL);
+ *\endcode
+ * @param lst   The linked list that is going to be sorted.
+ * @param cmp   Comparison function that returns a negative number, zero,
+ *              or a positive number if its first argument should be
+ *              ordered before, equal to, or after its second argument,
+ *              respectively. Its arguments are two items from \p lst,
+ *              followed by \p ctx.
+ * @param ctx   User data that is passed on to \p cmp.
+ */
+void llist__sort (LinkedList * lst, int (*cmp)(const void *, const void *, void *), void * ctx);
+
+
+
+
+/**
+ * @brief       Move all items of one linked list into another
+ * @details     The nodes of \p src are relinked rather than copied, so
+ *              apart from finding \p pos (which walks from whichever
+ *              end of \p dst is closest) this takes constant time. Both
+ *              linked lists must draw their nodes from the same pool
+ *              and allocator, or else the program terminates.
+ *              Afterwards, \p src is empty.
+ * @param dst   The linked list into which the items are moved.
+ * @param pos   Zero based pseudo index in \p dst where the first item
+ *              of \p src should end up.
+ * @param src   The linked list whose items are moved.
+ */
+void llist__splice (LinkedList * dst, const size_t pos, LinkedList * src);
+
+
+
+
+/**
+ * @brief       Split a linked list in two
+ * @details     The items from \p pos onwards are moved into a new
+ *              linked list by relinking their nodes, so apart from
+ *              finding \p pos (which walks from whichever end of \p lst
+ *              is closest) this takes constant time. The new linked list
+ *              draws its nodes from the same pool as \p lst, if any.
+ * @param lst   The linked list that is going to be split. It keeps the
+ *              items before \p pos.
+ * @param pos   Zero based index of the first item that moves to the
+ *              new linked list.
+ * @returns     A new linked list holding the items from \p pos
+ *              onwards. Destroy it with ::llist__destroy.
+ */
+LinkedList * llist__split (LinkedList * lst, const size_t pos);
+
+
+
+
+/**
+ * @brief          Switch the positional index of a linked list on or
+ *                 off
+ * @details
+ * An indexed linked list maintains an order-statistic skip list on top
+ * of its nodes, such that ::llist__insert, ::llist__get and
+ * ::llist__remove take O(log n) time at any position, at the cost of
+ * roughly one extra allocation per three nodes. Operations that relink
+ * many nodes at once, such as ::llist__delete, mark the index as stale
+ * instead of updating it; it is then rebuilt in a single pass by the
+ * next positional operation. Small linked lists are usually better off
+ * without an index. The index draws its memory from the allocator of
+ * \p lst, see ::llist__try_create; running out of it terminates the
+ * program, unless the index is switched on with
+ * ::llist__try_set_indexed.
+ * @param lst      The linked list whose index is switched on or off.
+ * @param indexed  Whether \p lst should maintain an index.
+ */
+void llist__set_indexed (LinkedList * lst, const bool indexed);
+
+
+
+
+/**
+ * @brief        Get the operation counters of a linked list, or of all
+ *               linked lists together
+ * @details
+ * The counters only exist if the library was built with the CMake
+ * option `LLIST_STATS`, which defines the macro of the same name:
+ *\code{.sh}
+ *     cmake -DLLIST_STATS=ON ../..
+ *\endcode
+ * Every counted operation then reads the monotonic clock twice.
+ * Without the option, the library contains no instrumentation at all
+ * and this function reports zeros.
+ * @param lst    The linked list whose counters are wanted, or `NULL`
+ *               for the totals over all linked lists since the program
+ *               started or since ::llist__stats_reset. The totals are
+ *               safe to read while other threads use other lists.
+ * @param stats  Where to store the counters.
+ * @returns      `true` if the library counts operations, `false` if it
+ *               was built without `LLIST_STATS`.
+ */
+bool llist__stats (const LinkedList * lst, llist__Stats * stats);
+
+
+
+
+/**
+ * @brief        Write operation counters as a single line of JSON
+ * @details      The output looks like
+ *
+ *               @code{.json}
+ *               {"nallocs": 3, "nfrees": 1, "ops": {"insert": {"count": 3, "nodes": 0, "latency_ns_log2": [0, ...]}, ...}}
+ *               @endcode
+ *
+ *               with one member in `ops` per ::llist__StatsOp, in
+ *               order, and ::LLIST_STATS_NBUCKETS numbers per
+ *               histogram.
+ * @param stats  The counters, as obtained from ::llist__stats.
+ * @param fd     Where the output should be written.
+ */
+void llist__stats_dump (const llist__Stats * stats, FILE * fd);
+
+
+
+
+/**
+ * @brief      Reset the operation counters of a linked list, or the
+ *             totals over all linked lists
+ * @param lst  The linked list whose counters are reset, or `NULL` to
+ *             reset the totals.
+ */
+void llist__stats_reset (LinkedList * lst);
+
+
+
+
+/**
+ * @brief      Switch the keyed index of a linked list on or off
+ * @details
+ * A keyed linked list maintains a hash table from the key of every item
+ * to its node, such that ::llist__find, ::llist__contains,
+ * ::llist__delete_key and ::llist__move_to_front take expected constant
+ * time. Inserting and removing single items keeps the table up to date;
+ * operations that move many nodes between linked lists at once, such as
+ * ::llist__splice, mark it as stale instead, after which the next keyed
+ * operation rebuilds it in a single pass. The table keeps at least two
+ * slots of 16 bytes per item, and draws its memory from the allocator
+ * of \p lst, see ::llist__try_create; running out of it terminates the
+ * program, unless the table is built with ::llist__try_set_keyed.
+ *\code{.c}
+ *     static uint64_t hash_int (const void * key, void *) {
+ *         return (uint64_t) *((const int *) key);
+ *     }
+ *
+ *     static bool equal_ints (const void * a, const void * b, void *) {
+ *         return *((const int *) a) == *((const int *) b);
+ *     }
+ *
+ *     llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+ *     llist__set_keyed(lst, &ops);
+ *     int key = 42;
+ *     int * item = llist__find(lst, &key);
+ *\endcode
+ * @param lst  The linked list whose keyed index is switched on or off.
+ * @param ops  How to get, hash and compare the keys of the items in \p
+ *             lst, or `NULL` to switch the keyed index off. Switching
+ *             it on for a linked list that is already keyed replaces
+ *             the key functions and rebuilds the table.
+ */
+void llist__set_keyed (LinkedList * lst, const llist__KeyOps * ops);
+
+
+
+
+/**
+ * @brief           Prefetch nodes ahead of traversals of a linked list
+ * @details
+ * Traversing a linked list chases one pointer per node, and each node
+ * that is not in cache stalls the traversal for a full memory access.
+ * With prefetching on, ::llist__delete, ::llist__delete_ctx and
+ * ::llist__print record the address of every node they visit in an
+ * array of 8 bytes per item. As long as the linked list isn't changed
+ * other than by deleting items this way, the next such traversal, or
+ * ::llist__destroy, reads the addresses of upcoming nodes from that
+ * array and prefetches the node, and optionally the payload, that the
+ * filter or printer is going to touch \p distance steps later, so that
+ * many memory accesses are in flight at once. This pays off for linked
+ * lists that are traversed repeatedly and whose nodes or payloads are
+ * scattered across a heap much larger than the last level cache; for
+ * small or compact linked lists it only adds work. See ::llist__compact
+ * for an alternative. The array draws its memory from the allocator of
+ * \p lst, see ::llist__try_create; when that runs out, traversals stop
+ * recording and simply don't prefetch.
+ * @param lst       The linked list.
+ * @param distance  How many nodes to prefetch ahead, or 0 to switch
+ *                  prefetching off and free the array, which is the
+ *                  default.
+ * @param payloads  Whether to prefetch the payloads too.
+ */
+void llist__set_prefetch (LinkedList * lst, const size_t distance, const bool payloads);
+
+
+
+
+/**
+ * @brief      Release the spare nodes of a linked list
+ * @details    Hands the spare nodes of \p lst back to `malloc`, its pool
+ *             or its ::llist__Allocator, and stops \p lst from keeping
+ *             released nodes until the next ::llist__reserve. Takes time
+ *             proportional to the number of spare nodes.
+ * @param lst  The linked list.
+ */
+void llist__shrink_to_fit (LinkedList * lst);
+
+
+
+
+/**
+ * @brief       Append an item to an instance of a linked list, unless
+ *              memory runs out
+ * @details     Like ::llist__append, but reports running out of memory
+ *              instead of terminating the program. See
+ *              ::llist__try_insert.
+ * @param lst   The instance of a linked list to which \p item is
+ *              going to be appended.
+ * @param item  The item that is going to be appended to \p lst.
+ * @returns     `true` if \p item was appended, `false` otherwise, in
+ *              which case `errno` is `ENOMEM` and \p lst is unchanged.
+ */
+bool llist__try_append (LinkedList * lst, void * item);
+
+
+
+
+/**
+ * @brief            Create an instance of a linked list that draws its
+ *                   memory from a given allocator, unless memory runs
+ *                   out
+ * @details
+ * The linked list itself and its nodes come from \p allocator, and go
+ * back to it when they are no longer needed. Combined with
+ * ::llist__try_insert and friends, a linked list can then run on a
+ * fixed budget and report running out of memory instead of terminating
+ * the program:
+ *\code{.c}
+ *     llist__Allocator budget = { .alloc = budget_alloc, .free = budget_free, .ctx = &remaining };
+ *     LinkedList * lst = llist__try_create(&budget);
+ *     if (lst == NULL || !llist__try_append(lst, item)) {
+ *         // handle ENOMEM
+ *     }
+ *\endcode
+ * Functions that have no `try` variant keep terminating the program
+ * when \p allocator runs out. The index, the keyed index and the
+ * prefetch array (see ::llist__try_set_indexed, ::llist__try_set_keyed
+ * and ::llist__try_set_prefetch) draw their memory from \p allocator
+ * too, and the `try` variants report when they can't grow. Only
+ * scratch buffers that live for the duration of a single call, such as
+ * those of ::llist__write and the parallel functions, come from
+ * `malloc`.
+ * Linked lists that exchange nodes, e.g. through ::llist__splice, must
+ * use the same allocator, or else the program terminates.
+ *
+ * Unlike other linked lists, a linked list with an allocator doesn't
+ * keep the nodes of deleted items as spares by default, such that
+ * deleting items from one linked list makes room for inserting them
+ * into another one on the same budget. ::llist__reserve opts in to
+ * keeping spares, and ::llist__shrink_to_fit hands them back.
+ * @param allocator  The allocator, which is copied, or `NULL` to use
+ *                   `malloc` and `free`.
+ * @returns          A pointer to the created instance of a linked list,
+ *                   or `NULL` with `errno` set to `ENOMEM`. Destroy it
+ *                   with ::llist__destroy.
+ */
+LinkedList * llist__try_create (const llist__Allocator * allocator);
+
+
+
+
+/**
+ * @brief       Insert an item at a given position into a linked list,
+ *              unless memory runs out
+ * @details     Like ::llist__insert, but reports running out of memory
+ *              instead of terminating the program, be it for the new
+ *              node, for growing the index (see ::llist__set_indexed)
+ *              or for growing the keyed index (see ::llist__set_keyed).
+ *              An index that went stale is not rebuilt, which might run
+ *              out of memory halfway; the position is found by walking
+ *              instead. Linked lists that draw their nodes from a pool
+ *              report running out of memory when the pool can't grow.
+ * @param pos   Zero based pseudo index where \p item should be
+ *              inserted into \p lst.
+ * @param item  The item to be inserted.
+ * @param lst   The linked list into which \p item should be inserted.
+ * @returns     `true` if \p item was inserted, `false` otherwise, in
+ *              which case `errno` is `ENOMEM` and \p lst is unchanged.
+ */
+bool llist__try_insert (const size_t pos, void * item, LinkedList * lst);
+
+
+
+
+/**
+ * @brief       Prepend an item to an instance of a linked list, unless
+ *              memory runs out
+ * @details     Like ::llist__prepend, but reports running out of memory
+ *              instead of terminating the program. See
+ *              ::llist__try_insert.
+ * @param lst   The instance of a linked list to which \p item is
+ *              going to be prepended.
+ * @param item  The item that is going to be prepended to \p lst.
+ * @returns     `true` if \p item was prepended, `false` otherwise, in
+ *              which case `errno` is `ENOMEM` and \p lst is unchanged.
+ */
+bool llist__try_prepend (LinkedList * lst, void * item);
+
+
+
+
+/**
+ * @brief          Switch the positional index of a linked list on or
+ *                 off, unless memory runs out
+ * @details        Like ::llist__set_indexed, but reports running out of
+ *                 memory for building the index instead of terminating
+ *                 the program.
+ * @param lst      The linked list whose index is switched on or off.
+ * @param indexed  Whether \p lst should maintain an index.
+ * @returns        `true` on success, `false` otherwise, in which case
+ *                 `errno` is `ENOMEM` and \p lst is unchanged.
+ */
+bool llist__try_set_indexed (LinkedList * lst, const bool indexed);
+
+
+
+
+/**
+ * @brief      Switch the keyed index of a linked list on or off,
+ *             unless memory runs out
+ * @details    Like ::llist__set_keyed, but reports running out of
+ *             memory for building the table instead of terminating the
+ *             program. The new table is built before the old one is
+ *             freed.
+ * @param lst  The linked list whose keyed index is switched on or off.
+ * @param ops  How to get, hash and compare the keys of the items in \p
+ *             lst, or `NULL` to switch the keyed index off.
+ * @returns    `true` on success, `false` otherwise, in which case
+ *             `errno` is `ENOMEM` and \p lst is keyed as it was.
+ */
+bool llist__try_set_keyed (LinkedList * lst, const llist__KeyOps * ops);
+
+
+
+
+/**
+ * @brief           Prefetch nodes ahead of traversals of a linked list,
+ *                  unless memory runs out
+ * @details         Like ::llist__set_prefetch, but reports running out
+ *                  of memory instead of terminating the program.
+ * @param lst       The linked list.
+ * @param distance  How many nodes to prefetch ahead, or 0 to switch
+ *                  prefetching off.
+ * @param payloads  Whether to prefetch the payloads too.
+ * @returns         `true` on success, `false` otherwise, in which case
+ *                  `errno` is `ENOMEM` and \p lst is unchanged.
+ */
+bool llist__try_set_prefetch (LinkedList * lst, const size_t distance, const bool payloads);
+
+
+
+
+/**
+ * @brief       Write the contents of a linked list to a file descriptor
+ *              in a few large `write` calls
+ * @details     Unlike ::llist__print, which goes through `stdio` for
+ *              every item, the items are formatted into one large
+ *              buffer that is flushed with `write(2)` whenever it
+ *              fills up. In text mode the output looks like that of
+ *              ::llist__print without printers, e.g.
+ *
+ *              @code{.c}
+ *              int arr[] = { 100, 101, 102 };
+ *              // ... append &arr[i] to lst
+ *              llist__WriteOptions opts = { .format = LLIST_FORMAT_INT };
+ *              llist__write(lst, &opts, STDOUT_FILENO);  // [100, 101, 102]
+ *              @endcode
+ *
+ *              Mixing ::llist__write and `stdio` on the same file
+ *              requires flushing the `FILE *` first.
+ * @param lst   The linked list whose contents should be written.
+ * @param opts  The output options, or `NULL` for the defaults. See
+ *              ::llist__WriteOptions.
+ * @param fd    The file descriptor to write to.
+ * @returns     `true` if all output was written, `false` if `write`
+ *              failed, in which case `errno` says why.
+ */
+bool llist__write (const LinkedList * lst, const llist__WriteOptions * opts, int fd);
+
 #endif
@@ -0,0 +1,150 @@
+/**
+ * @file
+ */
+
+
+#ifndef LRU_H
+#define LRU_H
+#include "llist/llist.h"
+#include <stddef.h>
+
+/**
+ * @brief  Fixed capacity cache that evicts the least recently used entry
+ *         when it is full. Each entry is a key and a value that the
+ *         caller owns. Looking up, inserting and evicting entries takes
+ *         expected constant time.
+ *
+ *         @code{.c}
+ *         llist__KeyOps ops = { .hash = hash_str, .equal = equal_strs };
+ *         llist__LruCache * cache = llist__lru_create(1000, &ops, free_entry, NULL);
+ *
+ *         Page * page = llist__lru_get(cache, url);
+ *         if (page == NULL) {
+ *             page = fetch(url);
+ *             llist__lru_put(cache, url, page);
+ *         }
+ *         @endcode
+ *
+ *         Internally, the entries are items of a keyed ::LinkedList (see
+ *         ::llist__set_keyed) that is ordered from most to least recently
+ *         used, with nodes drawn from a node pool of its own. A cache
+ *         that is full doesn't allocate anymore.
+ */
+typedef struct llist__lru_cache llist__LruCache;
+
+
+
+
+/**
+ * @brief           Create an instance of an LRU cache
+ * @param capacity  The maximum number of entries. Must be at least 1.
+ * @param ops       How to hash and compare keys. Its `key` member must
+ *                  be `NULL`; the other members are copied.
+ * @param evict     Optional. Called with the key and value of every
+ *                  entry that leaves the cache without being removed
+ *                  explicitly: entries that make room for new ones,
+ *                  entries whose value ::llist__lru_put replaces, and
+ *                  entries that remain when the cache is destroyed.
+ *                  Typically frees them.
+ * @param ctx       User data that is passed on to \p evict.
+ * @returns         A pointer to the created instance of an LRU cache.
+ */
+llist__LruCache * llist__lru_create (const size_t capacity, const llist__KeyOps * ops,
+                                     void (*evict)(const void * key, void * value, void * ctx), void * ctx);
+
+
+
+
+/**
+ * @brief        Destroy an instance of an LRU cache
+ * @details      The remaining entries are handed to the eviction
+ *               callback, from least to most recently used.
+ * @param cache  The instance of an LRU cache whose memory is going to be
+ *               freed.
+ */
+void llist__lru_destroy (llist__LruCache ** cache);
+
+
+
+
+/**
+ * @brief         Evict the least recently used entry from an LRU cache
+ * @details       Takes constant time. The entry is handed to the
+ *                eviction callback.
+ * @param cache   The LRU cache.
+ * @returns       `true` if an entry was evicted, `false` if \p cache
+ *                was empty.
+ */
+bool llist__lru_evict (llist__LruCache * cache);
+
+
+
+
+/**
+ * @brief        Look up the value for a key in an LRU cache, and mark
+ *               the entry as the most recently used one
+ * @details      Takes expected constant time.
+ * @param cache  The LRU cache.
+ * @param key    The key to look up.
+ * @returns      The value for \p key, or `NULL` if \p cache holds no
+ *               entry for \p key.
+ */
+void * llist__lru_get (llist__LruCache * cache, const void * key);
+
+
+
+
+/**
+ * @brief        Get the number of entries in an LRU cache
+ * @param cache  The LRU cache.
+ * @returns      The number of entries in \p cache.
+ */
+size_t llist__lru_get_length (const llist__LruCache * cache);
+
+
+
+
+/**
+ * @brief        Insert or update the entry for a key in an LRU cache,
+ *               and mark it as the most recently used one
+ * @details      Takes expected constant time. If \p cache already holds
+ *               an entry for \p key, that entry's key and value are
+ *               handed to the eviction callback and replaced by \p key
+ *               and \p value. Otherwise, if \p cache is full, its least
+ *               recently used entry is evicted first.
+ * @param cache  The LRU cache.
+ * @param key    The key of the entry. It must remain valid for as long
+ *               as the entry is in \p cache.
+ * @param value  The value of the entry.
+ */
+void llist__lru_put (llist__LruCache * cache, const void * key, void * value);
+
+
+
+
+/**
+ * @brief        Remove the entry for a key from an LRU cache, without
+ *               calling the eviction callback
+ * @details      Takes expected constant time.
+ * @param cache  The LRU cache.
+ * @param key    The key of the entry to remove.
+ * @returns      The value of the removed entry, or `NULL` if \p cache
+ *               holds no entry for \p key.
+ */
+void * llist__lru_remove (llist__LruCache * cache, const void * key);
+
+
+
+
+/**
+ * @brief        Mark the entry for a key as the most recently used one
+ * @details      Like ::llist__lru_get, but tells whether the entry
+ *               exists, which also works for `NULL` values.
+ * @param cache  The LRU cache.
+ * @param key    The key of the entry.
+ * @returns      `true` if \p cache holds an entry for \p key, `false`
+ *               otherwise.
+ */
+bool llist__lru_touch (llist__LruCache * cache, const void * key);
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * @file
+ */
+
+
+#ifndef PLLIST_H
+#define PLLIST_H
+#include "llist/llist.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief  Persistent linked list. Every ::PersistentList is an
+ *         immutable version: prepending or popping the first item
+ *         creates a new version that shares its tail with the old
+ *         one, in constant time, and leaves the old version intact.
+ *         Taking a snapshot of a version takes constant time and
+ *         doesn't allocate.
+ *
+ *         @code{.c}
+ *         // writer
+ *         PersistentList * next = pllist__prepend(current, item);
+ *         pllist__destroy(&current);
+ *         current = next;
+ *         cllist__queue_append(readers, pllist__snapshot(current));
+ *
+ *         // reader, in another thread
+ *         PersistentList * version = NULL;
+ *         cllist__queue_pop_front(readers, (void **) &version);
+ *         pllist__Iter it = pllist__iter_begin(version);
+ *         while (pllist__iter_next(&it)) {
+ *             consume(pllist__iter_get(&it));
+ *         }
+ *         pllist__destroy(&version);
+ *         @endcode
+ *
+ *         Nodes are reference counted with atomic counters, so versions
+ *         that share nodes may be read and destroyed from different
+ *         threads without locking; a node is freed when the last version
+ *         that reaches it is destroyed. The thread that hands a version
+ *         to another thread must own a reference to it while it takes
+ *         the snapshot. The list does not own its items.
+ */
+typedef struct pllist PersistentList;
+
+/**
+ * @struct pllist__Iter
+ *
+ * @brief  Cursor for visiting the items of a version in order. Obtain
+ *         one with ::pllist__iter_begin. Its members are private.
+ */
+typedef struct {
+    const struct pllist__node * next;
+    void * item;
+} pllist__Iter;
+
+
+
+
+/**
+ * @brief    Create an empty persistent linked list
+ * @returns  A pointer to the created version.
+ */
+PersistentList * pllist__create (void);
+
+
+
+
+/**
+ * @brief      Destroy a version of a persistent linked list
+ * @details    Releases the reference that \p lst holds. Nodes that no
+ *             other version shares are freed. Takes time proportional
+ *             to the number of freed nodes.
+ * @param lst  The version that is going to be released.
+ */
+void pllist__destroy (PersistentList ** lst);
+
+
+
+
+/**
+ * @brief      Get the first item of a version
+ * @param lst  The version. Must not be empty.
+ * @returns    The first item of \p lst.
+ */
+void * pllist__first (const PersistentList * lst);
+
+
+
+
+/**
+ * @brief      Get the item at a position of a version
+ * @details    Takes time proportional to \p pos.
+ * @param pos  The position of the item.
+ * @param lst  The version.
+ * @returns    The item at \p pos.
+ */
+void * pllist__get (const size_t pos, const PersistentList * lst);
+
+
+
+
+/**
+ * @brief      Get the number of items in a version
+ * @param lst  The version.
+ * @returns    The number of items in \p lst.
+ */
+size_t pllist__get_length (const PersistentList * lst);
+
+
+
+
+/**
+ * @brief      Create a cursor for a version
+ * @details    The cursor starts out positioned before the first item.
+ *             It stays valid for as long as the caller holds \p lst,
+ *             regardless of what other versions are created or
+ *             destroyed in the meantime.
+ * @param lst  The version that is going to be visited.
+ * @returns    A cursor positioned before the first item of \p lst.
+ */
+pllist__Iter pllist__iter_begin (const PersistentList * lst);
+
+
+
+
+/**
+ * @brief      Get the item under a cursor
+ * @details    The last call to ::pllist__iter_next must have returned
+ *             `true`.
+ * @param it   The cursor.
+ * @returns    The item under \p it.
+ */
+void * pllist__iter_get (const pllist__Iter * it);
+
+
+
+
+/**
+ * @brief      Move a cursor to the next item
+ * @param it   The cursor.
+ * @returns    `true` if the cursor moved onto an item, `false` if
+ *             there were no items left.
+ */
+bool pllist__iter_next (pllist__Iter * it);
+
+
+
+
+/**
+ * @brief       Create a version without the first item of another
+ * @details     Takes constant time. The new version shares all of its
+ *              nodes with \p lst, which remains unchanged.
+ * @param lst   The version. Must not be empty.
+ * @param item  Optional. Where the first item of \p lst is stored.
+ * @returns     A pointer to the created version.
+ */
+PersistentList * pllist__pop_front (const PersistentList * lst, void ** item);
+
+
+
+
+/**
+ * @brief       Create a version with an item in front of another
+ * @details     Takes constant time. The new version shares all of the
+ *              nodes of \p lst, which remains unchanged.
+ * @param lst   The version.
+ * @param item  The item that is going to be prepended.
+ * @returns     A pointer to the created version.
+ */
+PersistentList * pllist__prepend (const PersistentList * lst, void * item);
+
+
+
+
+/**
+ * @brief           Print a version
+ * @param lst       The version.
+ * @param printers  Optional. How to print the preamble, each item, and
+ *                  the postamble; see ::llist__Printers.
+ * @param fd        Where to print to.
+ */
+void pllist__print (const PersistentList * lst, const llist__Printers * printers, FILE * fd);
+
+
+
+
+/**
+ * @brief      Take a snapshot of a version
+ * @details    Takes constant time and doesn't allocate: the snapshot
+ *             is the same version with one more reference, and it is
+ *             released with ::pllist__destroy like any other version.
+ *             The items of \p lst don't change, but its reference count
+ *             does, which is why \p lst isn't `const`.
+ * @param lst  The version.
+ * @returns    \p lst.
+ */
+PersistentList * pllist__snapshot (PersistentList * lst);
+
+#endif
@@ -0,0 +1,233 @@
+/**
+ * @file
+ */
+
+
+#ifndef TLLIST_H
+#define TLLIST_H
+#include "llist/llist.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief  Define a linked list type \p name whose nodes store payloads
+ *         of type \p T inline, together with `static inline` functions
+ *         `name##__append`, `name##__create`, etc. that mirror the API
+ *         of ::LinkedList.
+ * @details
+ *         Where ::LinkedList stores a `void *` to an object that the
+ *         caller allocates separately, the generated list copies each
+ *         item into its node. An element then takes one allocation
+ *         instead of two, and reading it takes one pointer dereference
+ *         fewer. This suits small scalar and struct payloads; large
+ *         payloads are better off behind a pointer.
+ *
+ *         Functions that take or return items do so by value. Use
+ *         `name##__at` to get a pointer to an item inside its node; the
+ *         pointer remains valid until that item is removed.
+ *
+ *         Expand the macro once per payload type, at file scope, e.g.
+ *
+ *         @code{.c}
+ *         #include "llist/tllist.h"
+ *
+ *         typedef struct {
+ *             float x;
+ *             float y;
+ *         } Point;
+ *
+ *         LLIST_DEFINE(ilist, int)
+ *         LLIST_DEFINE(plist, Point)
+ *
+ *         ilist * lst = ilist__create();
+ *         ilist__append(lst, 42);
+ *         ilist__prepend(lst, 41);
+ *         int x = ilist__get(1, lst);  // 42
+ *         ilist__destroy(&lst);
+ *         @endcode
+ *
+ *         Failing allocations terminate the program, like they do for
+ *         ::LinkedList.
+ * @param name  The name of the list type. The generated functions are
+ *              prefixed with `name` followed by a double underscore.
+ * @param T     The payload type.
+ */
+#define LLIST_DEFINE(name, T)                                                                                          \
+    typedef struct name##__node {                                                                                      \
+        T payload;                                                                                                     \
+        struct name##__node * next;                                                                                    \
+        struct name##__node * prev;                                                                                    \
+    } name##__Node;                                                                                                    \
+                                                                                                                       \
+    typedef struct name {                                                                                              \
+        size_t nelems;                                                                                                 \
+        name##__Node * firstnode;                                                                                      \
+        name##__Node * lastnode;                                                                                       \
+    } name;                                                                                                            \
+                                                                                                                       \
+    static inline name##__Node * name##__node_new (T item) {                                                           \
+        name##__Node * node = malloc(sizeof(name##__Node));                                                            \
+        if (node == NULL) {                                                                                            \
+            fprintf(stderr, "Something went wrong allocating memory for new node.\n");                                 \
+            exit(EXIT_FAILURE);                                                                                        \
+        }                                                                                                              \
+        node->payload = item;                                                                                          \
+        return node;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__node_link (name * lst, name##__Node * prev, name##__Node * node,                        \
+                                          name##__Node * next) {                                                       \
+        node->prev = prev;                                                                                             \
+        node->next = next;                                                                                             \
+        if (prev == NULL) {                                                                                            \
+            lst->firstnode = node;                                                                                     \
+        } else {                                                                                                       \
+            prev->next = node;                                                                                         \
+        }                                                                                                              \
+        if (next == NULL) {                                                                                            \
+            lst->lastnode = node;                                                                                      \
+        } else {                                                                                                       \
+            next->prev = node;                                                                                         \
+        }                                                                                                              \
+        lst->nelems++;                                                                                                 \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T name##__node_unlink (name * lst, name##__Node * node) {                                            \
+        if (node->prev == NULL) {                                                                                      \
+            lst->firstnode = node->next;                                                                               \
+        } else {                                                                                                       \
+            node->prev->next = node->next;                                                                             \
+        }                                                                                                              \
+        if (node->next == NULL) {                                                                                      \
+            lst->lastnode = node->prev;                                                                                \
+        } else {                                                                                                       \
+            node->next->prev = node->prev;                                                                             \
+        }                                                                                                              \
+        lst->nelems--;                                                                                                 \
+        T payload = node->payload;                                                                                     \
+        free(node);                                                                                                    \
+        return payload;                                                                                                \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline name##__Node * name##__node_at (const name * lst, const size_t pos) {                                \
+        name##__Node * curr = NULL;                                                                                    \
+        if (pos < lst->nelems / 2) {                                                                                   \
+            curr = lst->firstnode;                                                                                     \
+            for (size_t i = 0; i < pos; i++) {                                                                         \
+                curr = curr->next;                                                                                     \
+            }                                                                                                          \
+        } else {                                                                                                       \
+            curr = lst->lastnode;                                                                                      \
+            for (size_t i = lst->nelems - 1; i > pos; i--) {                                                           \
+                curr = curr->prev;                                                                                     \
+            }                                                                                                          \
+        }                                                                                                              \
+        return curr;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__append (name * lst, T item) {                                                           \
+        name##__node_link(lst, lst->lastnode, name##__node_new(item), NULL);                                           \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T * name##__at (const size_t pos, name * lst) {                                                      \
+        assert(pos < lst->nelems && "Can't get element past the end of the list\n");                                   \
+        return &name##__node_at(lst, pos)->payload;                                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline name * name##__create (void) {                                                                       \
+        name * lst = malloc(sizeof(name));                                                                             \
+        if (lst == NULL) {                                                                                             \
+            fprintf(stderr, "Something went wrong allocating memory for the linked list.\n");                          \
+            exit(EXIT_FAILURE);                                                                                        \
+        }                                                                                                              \
+        *lst = (name) { .nelems = 0, .firstnode = NULL, .lastnode = NULL };                                            \
+        return lst;                                                                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__delete (const bool global, name * lst, bool (*filter)(const T *)) {                     \
+        name##__Node * curr = lst->firstnode;                                                                          \
+        while (curr != NULL) {                                                                                         \
+            name##__Node * next = curr->next;                                                                          \
+            if (filter(&curr->payload)) {                                                                              \
+                name##__node_unlink(lst, curr);                                                                        \
+                if (!global) return;                                                                                   \
+            }                                                                                                          \
+            curr = next;                                                                                               \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__destroy (name ** lst) {                                                                 \
+        name##__Node * curr = (*lst)->firstnode;                                                                       \
+        while (curr != NULL) {                                                                                         \
+            name##__Node * next = curr->next;                                                                          \
+            free(curr);                                                                                                \
+            curr = next;                                                                                               \
+        }                                                                                                              \
+        free(*lst);                                                                                                    \
+        *lst = NULL;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__for_each (name * lst, void (*fn)(T *, void *), void * ctx) {                            \
+        for (name##__Node * curr = lst->firstnode; curr != NULL; curr = curr->next) {                                  \
+            fn(&curr->payload, ctx);                                                                                   \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T name##__get (const size_t pos, const name * lst) {                                                 \
+        assert(pos < lst->nelems && "Can't get element past the end of the list\n");                                   \
+        return name##__node_at(lst, pos)->payload;                                                                     \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline size_t name##__get_length (const name * lst) {                                                       \
+        return lst->nelems;                                                                                            \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__insert (const size_t pos, T item, name * lst) {                                         \
+        assert(pos <= lst->nelems && "Can't insert element past the end of the list\n");                               \
+        name##__Node * next = pos == lst->nelems ? NULL : name##__node_at(lst, pos);                                   \
+        name##__Node * prev = next == NULL ? lst->lastnode : next->prev;                                               \
+        name##__node_link(lst, prev, name##__node_new(item), next);                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T name##__pop_back (name * lst) {                                                                    \
+        assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");                                        \
+        return name##__node_unlink(lst, lst->lastnode);                                                                \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T name##__pop_front (name * lst) {                                                                   \
+        assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");                                        \
+        return name##__node_unlink(lst, lst->firstnode);                                                               \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__prepend (name * lst, T item) {                                                          \
+        name##__node_link(lst, NULL, name##__node_new(item), lst->firstnode);                                          \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void name##__print (const name * lst, const llist__Printers * printers, FILE * fd) {                 \
+        if (printers == NULL || printers->pre == NULL) {                                                               \
+            fprintf(fd, "[");                                                                                          \
+        } else {                                                                                                       \
+            printers->pre(fd, lst->nelems);                                                                            \
+        }                                                                                                              \
+        size_t i = 0;                                                                                                  \
+        for (name##__Node * curr = lst->firstnode; curr != NULL; curr = curr->next, i++) {                             \
+            if (printers == NULL || printers->elem == NULL) {                                                          \
+                fprintf(fd, "%p%s", (void *) &curr->payload, curr->next == NULL ? "" : ", ");                          \
+            } else {                                                                                                   \
+                printers->elem(fd, i, lst->nelems, (void *) &curr->payload);                                           \
+            }                                                                                                          \
+        }                                                                                                              \
+        if (printers == NULL || printers->post == NULL) {                                                              \
+            fprintf(fd, "]\n");                                                                                        \
+        } else {                                                                                                       \
+            printers->post(fd, lst->nelems);                                                                           \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T name##__remove (const size_t pos, name * lst) {                                                    \
+        assert(pos < lst->nelems && "Can't remove element past the end of the list\n");                                \
+        return name##__node_unlink(lst, name##__node_at(lst, pos));                                                    \
+    }
+
+#endif
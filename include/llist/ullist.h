@@ -0,0 +1,170 @@
+/**
+ * @file
+ */
+
+
+#ifndef ULLIST_H
+#define ULLIST_H
+#include "llist/llist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief  Unrolled linked list. Every node ("chunk") stores up to
+ *         ::ULLIST_CHUNK_CAPACITY items in a small array, so that a
+ *         full traversal touches one cache line pair per chunk instead
+ *         of one node per item. The API mirrors that of ::LinkedList.
+ */
+typedef struct ullist UnrolledList;
+
+/**
+ * @brief  The number of items stored in a single chunk. Chosen such
+ *         that one chunk occupies 128 bytes on 64-bit platforms.
+ */
+#define ULLIST_CHUNK_CAPACITY 13
+
+
+
+
+/**
+ * @brief       Append an item to an instance of an unrolled linked list
+ * @details     Takes constant time.
+ * @param lst   The instance of an unrolled linked list to which \p
+ *              item is going to be appended.
+ * @param item  The item that is going to be appended to \p lst.
+ */
+void ullist__append (UnrolledList * lst, void * item);
+
+
+
+
+/**
+ * @brief    Create an instance of an unrolled linked list
+ * @returns  A pointer to the created instance of an unrolled linked
+ *           list.
+ */
+UnrolledList * ullist__create (void);
+
+
+
+
+/**
+ * @brief         Delete an item from an instance of an unrolled linked
+ *                list using a filter function
+ * @details       Behaves like ::llist__delete. Chunks that become
+ *                sparse as a result of the deletion are merged with
+ *                their neighbors.
+ * @param global  If `true`, the deletion is applied globally, i.e. to
+ *                all items in \p lst that match according to \p
+ *                filter; if `false`, deletion is applied only to the
+ *                first matching item.
+ * @param lst     The instance of an unrolled linked list from which an
+ *                item is going to be deleted.
+ * @param filter  The function that is used to determine whether
+ *                individual items in \p lst qualify for deletion
+ *                (return value `true`) or that they should remain
+ *                (return value `false`).
+ */
+void ullist__delete (const bool global, UnrolledList * lst, bool (*filter)(void *));
+
+
+
+
+/**
+ * @brief      Destroy an instance of an unrolled linked list
+ * @details
+ * @param lst  The instance of an unrolled linked list whose memory is
+ *             going to be freed.
+ */
+void ullist__destroy (UnrolledList ** lst);
+
+
+
+
+/**
+ * @brief       Insert an item at a given position into an unrolled
+ *              linked list.
+ * @details     A full chunk is split in two halves to make room for
+ *              \p item.
+ * @param pos   Zero based pseudo index where \p item should be
+ *              inserted into \p lst.
+ * @param item  The item to be inserted.
+ * @param lst   The unrolled linked list into which \p item should be
+ *              inserted.
+ */
+void ullist__insert (const size_t pos, void * item, UnrolledList * lst);
+
+
+
+
+/**
+ * @brief      Get the number of items currently stored in an instance
+ *             of an unrolled linked list
+ * @details
+ * @param lst  The instance of an unrolled linked list whose length is
+ *             being queried.
+ * @returns    The number of items in \p lst.
+ */
+size_t ullist__get_length (const UnrolledList * lst);
+
+
+
+
+/**
+ * @brief      Remove the last item from an instance of an unrolled
+ *             linked list
+ * @details    Takes constant time. \p lst must not be empty.
+ * @param lst  The instance of an unrolled linked list whose last item
+ *             is going to be removed.
+ * @returns    The item that was removed from \p lst.
+ */
+void * ullist__pop_back (UnrolledList * lst);
+
+
+
+
+/**
+ * @brief      Remove the first item from an instance of an unrolled
+ *             linked list
+ * @details    Takes constant time. \p lst must not be empty.
+ * @param lst  The instance of an unrolled linked list whose first item
+ *             is going to be removed.
+ * @returns    The item that was removed from \p lst.
+ */
+void * ullist__pop_front (UnrolledList * lst);
+
+
+
+
+/**
+ * @brief       Prepend an item to an instance of an unrolled linked
+ *              list
+ * @details     Takes constant time.
+ * @param lst   The instance of an unrolled linked list to which \p
+ *              item is going to be prepended.
+ * @param item  The item that is going to be prepended to \p lst.
+ */
+void ullist__prepend (UnrolledList * lst, void * item);
+
+
+
+
+/**
+ * @brief           Print the contents of an instance of an unrolled
+ *                  linked list, optionally using a custom printer
+ *                  function
+ * @details         Behaves like ::llist__print, and accepts the same
+ *                  printers.
+ * @param lst       The unrolled linked list whose contents should be
+ *                  printed.
+ * @param printers  The printer function pointers. A default printer
+ *                  function will be substituted for any member that
+ *                  is NULL. If \p printers itself is NULL, all of its
+ *                  printer functions will be substituted with default
+ *                  functions.
+ * @param fd        Where the output should be written. Typically,
+ *                  `stdout`.
+ */
+void ullist__print (const UnrolledList * lst, const llist__Printers * printers, FILE * fd);
+
+#endif
@@ -1,4 +1,5 @@
 #include "llist/llist.h"
+#include "llist/tllist.h"
 #include <math.h>
 #include <stdio.h>
 
@@ -28,6 +29,12 @@ static void printer_post (FILE * fd, size_t) {
     fprintf(fd, "}\n");
 }
 
+LLIST_DEFINE(ilist, int)
+
+static bool filter_inline (const int * p) {
+    return *p > 100;
+}
+
 static bool filter (void * p) {
     int elem = *((int *) p);
     return elem > 100;
@@ -104,6 +111,22 @@ int main (void) {
     fprintf(stdout, " -- ");
     llist__print(lst2, &printers2, stdout);
 
+    // ---------------------------------------------------------- //
+
+    fprintf(stdout, "\n");
+
+    fprintf(stdout, "Lists defined with LLIST_DEFINE store their items inside the nodes,\n"
+                    "so there is no need to keep the ints alive elsewhere:\n");
+    ilist * lst3 = ilist__create();
+    for (int i = 100; i < 104; i++) {
+        ilist__append(lst3, i);
+    }
+    ilist__print(lst3, &printers1, stdout);
+    ilist__delete(true, lst3, filter_inline);
+    ilist__print(lst3, &printers1, stdout);
+
+    ilist__destroy(&lst3);
+
     fprintf(stdout, "\nDone.\n");
 
     return EXIT_SUCCESS;
@@ -0,0 +1,221 @@
+#include "llist/allist.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ALLIST_MIN_CAPACITY 16
+#define NIL UINT32_MAX
+
+struct allist {
+    size_t nelems;
+    size_t capacity;
+    size_t nused;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t spare;
+    uint32_t * next;
+    uint32_t * prev;
+    void ** items;
+};
+
+static void slots_resize (ArrayLinkedList * lst, const size_t capacity) {
+    // indices stay valid across a move, so the arrays can be relocated as a whole
+    uint32_t * next = realloc(lst->next, sizeof(uint32_t) * capacity);
+    if (next != NULL) lst->next = next;
+    uint32_t * prev = realloc(lst->prev, sizeof(uint32_t) * capacity);
+    if (prev != NULL) lst->prev = prev;
+    void ** items = realloc(lst->items, sizeof(void *) * capacity);
+    if (items != NULL) lst->items = items;
+    if (next == NULL || prev == NULL || items == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the slots of array-backed linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    lst->capacity = capacity;
+}
+
+static uint32_t slot_take (ArrayLinkedList * lst) {
+    // reuse the most recently freed slot, or else the next one that was never used
+    if (lst->spare != NIL) {
+        uint32_t slot = lst->spare;
+        lst->spare = lst->next[slot];
+        return slot;
+    }
+    if (lst->nused == lst->capacity) {
+        if (lst->capacity == ALLIST_MAX_LENGTH) {
+            fprintf(stderr, "Array-backed linked list can't hold more than %zu items.\n", ALLIST_MAX_LENGTH);
+            exit(EXIT_FAILURE);
+        }
+        size_t capacity = lst->capacity < ALLIST_MIN_CAPACITY ? ALLIST_MIN_CAPACITY : lst->capacity * 2;
+        slots_resize(lst, capacity < ALLIST_MAX_LENGTH ? capacity : ALLIST_MAX_LENGTH);
+    }
+    return (uint32_t) lst->nused++;
+}
+
+static uint32_t slot_at (const ArrayLinkedList * lst, const size_t pos) {
+    // walk from whichever end of the list is closest to pos
+    assert(pos < lst->nelems && "Can't get slot past the end of the list\n");
+    uint32_t curr = NIL;
+    if (pos < lst->nelems / 2) {
+        curr = lst->head;
+        for (size_t i = 0; i < pos; i++) {
+            curr = lst->next[curr];
+        }
+    } else {
+        curr = lst->tail;
+        for (size_t i = lst->nelems - 1; i > pos; i--) {
+            curr = lst->prev[curr];
+        }
+    }
+    return curr;
+}
+
+static void slot_link (ArrayLinkedList * lst, const uint32_t prev, const uint32_t slot, const uint32_t next,
+                       void * item) {
+    // link slot in between prev and next, either of which may be NIL
+    lst->items[slot] = item;
+    lst->prev[slot] = prev;
+    lst->next[slot] = next;
+    if (prev == NIL) {
+        lst->head = slot;
+    } else {
+        lst->next[prev] = slot;
+    }
+    if (next == NIL) {
+        lst->tail = slot;
+    } else {
+        lst->prev[next] = slot;
+    }
+    lst->nelems++;
+}
+
+static void * slot_unlink (ArrayLinkedList * lst, const uint32_t slot) {
+    const uint32_t prev = lst->prev[slot];
+    const uint32_t next = lst->next[slot];
+    if (prev == NIL) {
+        lst->head = next;
+    } else {
+        lst->next[prev] = next;
+    }
+    if (next == NIL) {
+        lst->tail = prev;
+    } else {
+        lst->prev[next] = prev;
+    }
+    lst->next[slot] = lst->spare;
+    lst->spare = slot;
+    lst->nelems--;
+    return lst->items[slot];
+}
+
+void allist__append (ArrayLinkedList * lst, void * item) {
+    slot_link(lst, lst->tail, slot_take(lst), NIL, item);
+}
+
+ArrayLinkedList * allist__create (const size_t capacity) {
+    assert(capacity <= ALLIST_MAX_LENGTH && "Expected the capacity to fit the 32-bit slot indices\n");
+    ArrayLinkedList * lst = malloc(sizeof(ArrayLinkedList) * 1);
+    if (lst == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for array-backed linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    lst->nelems = 0;
+    lst->capacity = 0;
+    lst->nused = 0;
+    lst->head = NIL;
+    lst->tail = NIL;
+    lst->spare = NIL;
+    lst->next = NULL;
+    lst->prev = NULL;
+    lst->items = NULL;
+    if (capacity > 0) {
+        slots_resize(lst, capacity);
+    }
+    return lst;
+}
+
+void allist__delete (const bool global, ArrayLinkedList * lst, bool (*filter)(void *)) {
+    uint32_t curr = lst->head;
+    while (curr != NIL) {
+        uint32_t next = lst->next[curr];
+        if (filter(lst->items[curr])) {
+            slot_unlink(lst, curr);
+            if (!global) return;
+        }
+        curr = next;
+    }
+}
+
+void allist__destroy (ArrayLinkedList ** lst) {
+    free((*lst)->next);
+    free((*lst)->prev);
+    free((*lst)->items);
+    free(*lst);
+    *lst = NULL;
+}
+
+void * allist__get (const size_t pos, const ArrayLinkedList * lst) {
+    assert(pos < lst->nelems && "Can't get element past the end of the list\n");
+    return lst->items[slot_at(lst, pos)];
+}
+
+size_t allist__get_length (const ArrayLinkedList * lst) {
+    return lst->nelems;
+}
+
+void allist__insert (const size_t pos, void * item, ArrayLinkedList * lst) {
+    assert(pos <= lst->nelems && "Can't insert element past the end of the list\n");
+    uint32_t slot = slot_take(lst);
+    if (pos == lst->nelems) {
+        slot_link(lst, lst->tail, slot, NIL, item);
+    } else {
+        uint32_t next = slot_at(lst, pos);
+        slot_link(lst, lst->prev[next], slot, next, item);
+    }
+}
+
+void * allist__pop_back (ArrayLinkedList * lst) {
+    assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");
+    return slot_unlink(lst, lst->tail);
+}
+
+void * allist__pop_front (ArrayLinkedList * lst) {
+    assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");
+    return slot_unlink(lst, lst->head);
+}
+
+void allist__prepend (ArrayLinkedList * lst, void * item) {
+    slot_link(lst, NIL, slot_take(lst), lst->head, item);
+}
+
+void allist__print (const ArrayLinkedList * lst, const llist__Printers * printers, FILE * fd) {
+
+    // -- print preamble
+    if (printers == NULL || printers->pre == NULL) {
+        fprintf(fd, "[");
+    } else {
+        printers->pre(fd, lst->nelems);
+    }
+
+    // -- print each elem
+    size_t i = 0;
+    for (uint32_t curr = lst->head; curr != NIL; curr = lst->next[curr], i++) {
+        if (printers == NULL || printers->elem == NULL) {
+            fprintf(fd, "%p%s", lst->items[curr], i == lst->nelems - 1 ? "" : ", ");
+        } else {
+            printers->elem(fd, i, lst->nelems, lst->items[curr]);
+        }
+    }
+
+    // -- print postamble
+    if (printers == NULL || printers->post == NULL) {
+        fprintf(fd, "]\n");
+    } else {
+        printers->post(fd, lst->nelems);
+    }
+}
+
+void * allist__remove (const size_t pos, ArrayLinkedList * lst) {
+    assert(pos < lst->nelems && "Can't remove element past the end of the list\n");
+    return slot_unlink(lst, slot_at(lst, pos));
+}
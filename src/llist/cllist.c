@@ -0,0 +1,290 @@
+#include "llist/cllist.h"
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#define HP_PER_THREAD 2
+
+typedef struct cnode CNode;
+
+typedef struct hp_record HpRecord;
+
+struct cnode {
+    void * payload;
+    _Atomic(struct cnode *) next;
+};
+
+struct cllist__stack {
+    _Atomic(CNode *) top;
+};
+
+struct cllist__queue {
+    _Atomic(CNode *) head;
+    _Atomic(CNode *) tail;
+};
+
+// Hazard pointers: every thread that touches a stack or queue owns one
+// record holding the nodes it is about to dereference. Records are never
+// freed, only handed over to another thread once their owner exits.
+// Popped nodes are retired into the owner's private list, and freed in
+// batches once no record mentions them anymore.
+struct hp_record {
+    _Atomic(CNode *) hazards[HP_PER_THREAD];
+    atomic_bool active;
+    HpRecord * next;
+    CNode ** retired;
+    size_t nretired;
+    size_t capacity;
+};
+
+static _Atomic(HpRecord *) hp_records = NULL;
+
+static atomic_size_t hp_nrecords = 0;
+
+static thread_local HpRecord * hp_mine = NULL;
+
+static tss_t hp_key;
+
+static once_flag hp_once = ONCE_FLAG_INIT;
+
+static void hp_scan (HpRecord * rec) {
+    size_t nkept = 0;
+    for (size_t i = 0; i < rec->nretired; i++) {
+        bool hazardous = false;
+        for (HpRecord * curr = atomic_load(&hp_records); curr != NULL && !hazardous; curr = curr->next) {
+            for (size_t j = 0; j < HP_PER_THREAD; j++) {
+                if (atomic_load(&curr->hazards[j]) == rec->retired[i]) {
+                    hazardous = true;
+                    break;
+                }
+            }
+        }
+        if (hazardous) {
+            rec->retired[nkept++] = rec->retired[i];
+        } else {
+            free(rec->retired[i]);
+        }
+    }
+    rec->nretired = nkept;
+}
+
+static void hp_release (void * p) {
+    // runs when a thread exits; leftover retired nodes travel along with
+    // the record to whichever thread adopts it next
+    HpRecord * rec = p;
+    for (size_t i = 0; i < HP_PER_THREAD; i++) {
+        atomic_store(&rec->hazards[i], NULL);
+    }
+    hp_scan(rec);
+    atomic_store(&rec->active, false);
+}
+
+static void hp_init (void) {
+    if (tss_create(&hp_key, hp_release) != thrd_success) {
+        fprintf(stderr, "Something went wrong creating thread specific storage for hazard pointers.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static HpRecord * hp_acquire (void) {
+    if (hp_mine != NULL) return hp_mine;
+    call_once(&hp_once, hp_init);
+    HpRecord * rec = NULL;
+    for (HpRecord * curr = atomic_load(&hp_records); curr != NULL; curr = curr->next) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&curr->active, &expected, true)) {
+            rec = curr;
+            break;
+        }
+    }
+    if (rec == NULL) {
+        rec = malloc(sizeof(HpRecord) * 1);
+        if (rec == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for hazard pointer record.\n");
+            exit(EXIT_FAILURE);
+        }
+        for (size_t i = 0; i < HP_PER_THREAD; i++) {
+            atomic_init(&rec->hazards[i], NULL);
+        }
+        atomic_init(&rec->active, true);
+        rec->retired = NULL;
+        rec->nretired = 0;
+        rec->capacity = 0;
+        HpRecord * head = atomic_load(&hp_records);
+        do {
+            rec->next = head;
+        } while (!atomic_compare_exchange_weak(&hp_records, &head, rec));
+        atomic_fetch_add(&hp_nrecords, 1);
+    }
+    tss_set(hp_key, rec);
+    hp_mine = rec;
+    return rec;
+}
+
+static CNode * hp_protect (HpRecord * rec, size_t slot, _Atomic(CNode *) * src) {
+    // publish the hazard, then check that src still points to the same
+    // node, i.e. that it wasn't retired before the hazard became visible
+    CNode * node = atomic_load(src);
+    while (true) {
+        atomic_store(&rec->hazards[slot], node);
+        CNode * again = atomic_load(src);
+        if (again == node) return node;
+        node = again;
+    }
+}
+
+static void hp_clear (HpRecord * rec) {
+    for (size_t i = 0; i < HP_PER_THREAD; i++) {
+        atomic_store(&rec->hazards[i], NULL);
+    }
+}
+
+static void hp_retire (HpRecord * rec, CNode * node) {
+    if (rec->nretired == rec->capacity) {
+        size_t capacity = rec->capacity == 0 ? 64 : 2 * rec->capacity;
+        CNode ** retired = realloc(rec->retired, sizeof(CNode *) * capacity);
+        if (retired == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for retired nodes.\n");
+            exit(EXIT_FAILURE);
+        }
+        rec->retired = retired;
+        rec->capacity = capacity;
+    }
+    rec->retired[rec->nretired++] = node;
+    // scanning costs O(R * H), so wait until there are more retired
+    // nodes than hazards to amortize it
+    if (rec->nretired >= 2 * HP_PER_THREAD * atomic_load(&hp_nrecords) + 64) {
+        hp_scan(rec);
+    }
+}
+
+static CNode * cnode_alloc (void * item) {
+    CNode * node = malloc(sizeof(CNode) * 1);
+    if (node == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for new node in concurrent list.\n");
+        exit(EXIT_FAILURE);
+    }
+    node->payload = item;
+    atomic_init(&node->next, NULL);
+    return node;
+}
+
+void cllist__queue_append (ConcurrentQueue * q, void * item) {
+    HpRecord * rec = hp_acquire();
+    CNode * node = cnode_alloc(item);
+    while (true) {
+        CNode * tail = hp_protect(rec, 0, &q->tail);
+        CNode * next = atomic_load(&tail->next);
+        if (tail != atomic_load(&q->tail)) continue;
+        if (next != NULL) {
+            // another thread appended but hasn't swung the tail yet
+            atomic_compare_exchange_strong(&q->tail, &tail, next);
+            continue;
+        }
+        CNode * expected = NULL;
+        if (atomic_compare_exchange_strong(&tail->next, &expected, node)) {
+            atomic_compare_exchange_strong(&q->tail, &tail, node);
+            break;
+        }
+    }
+    hp_clear(rec);
+}
+
+ConcurrentQueue * cllist__queue_create (void) {
+    ConcurrentQueue * q = malloc(sizeof(ConcurrentQueue) * 1);
+    if (q == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for concurrent queue.\n");
+        exit(EXIT_FAILURE);
+    }
+    CNode * dummy = cnode_alloc(NULL);
+    atomic_init(&q->head, dummy);
+    atomic_init(&q->tail, dummy);
+    return q;
+}
+
+void cllist__queue_destroy (ConcurrentQueue ** q) {
+    CNode * curr = atomic_load(&(*q)->head);
+    while (curr != NULL) {
+        CNode * tmp = curr;
+        curr = atomic_load(&curr->next);
+        free(tmp);
+    }
+    free(*q);
+    *q = NULL;
+}
+
+bool cllist__queue_pop_front (ConcurrentQueue * q, void ** item) {
+    HpRecord * rec = hp_acquire();
+    while (true) {
+        CNode * head = hp_protect(rec, 0, &q->head);
+        CNode * tail = atomic_load(&q->tail);
+        CNode * next = hp_protect(rec, 1, &head->next);
+        if (head != atomic_load(&q->head)) continue;
+        if (next == NULL) {
+            hp_clear(rec);
+            return false;
+        }
+        if (head == tail) {
+            // tail is lagging behind; help it along
+            atomic_compare_exchange_strong(&q->tail, &tail, next);
+            continue;
+        }
+        void * payload = next->payload;
+        if (atomic_compare_exchange_strong(&q->head, &head, next)) {
+            // next is the new dummy node, the old dummy can go
+            hp_clear(rec);
+            hp_retire(rec, head);
+            *item = payload;
+            return true;
+        }
+    }
+}
+
+ConcurrentStack * cllist__stack_create (void) {
+    ConcurrentStack * s = malloc(sizeof(ConcurrentStack) * 1);
+    if (s == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for concurrent stack.\n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_init(&s->top, NULL);
+    return s;
+}
+
+void cllist__stack_destroy (ConcurrentStack ** s) {
+    CNode * curr = atomic_load(&(*s)->top);
+    while (curr != NULL) {
+        CNode * tmp = curr;
+        curr = atomic_load(&curr->next);
+        free(tmp);
+    }
+    free(*s);
+    *s = NULL;
+}
+
+bool cllist__stack_pop (ConcurrentStack * s, void ** item) {
+    HpRecord * rec = hp_acquire();
+    while (true) {
+        CNode * top = hp_protect(rec, 0, &s->top);
+        if (top == NULL) {
+            hp_clear(rec);
+            return false;
+        }
+        CNode * next = atomic_load(&top->next);
+        if (atomic_compare_exchange_strong(&s->top, &top, next)) {
+            hp_clear(rec);
+            *item = top->payload;
+            hp_retire(rec, top);
+            return true;
+        }
+    }
+}
+
+void cllist__stack_push (ConcurrentStack * s, void * item) {
+    CNode * node = cnode_alloc(item);
+    CNode * top = atomic_load(&s->top);
+    do {
+        atomic_store(&node->next, top);
+    } while (!atomic_compare_exchange_weak(&s->top, &top, node));
+}
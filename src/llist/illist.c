@@ -0,0 +1,197 @@
+#include "llist/illist.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef llist__Link Link;
+
+struct illist {
+    size_t nelems;
+    Link * firstlink;
+    Link * lastlink;
+};
+
+static Link * link_at (const IntrusiveList * lst, const size_t pos) {
+    // walk from whichever end of the list is closest to pos
+    assert(pos < lst->nelems && "Can't get link past the end of the list\n");
+    Link * curr = NULL;
+    if (pos < lst->nelems / 2) {
+        curr = lst->firstlink;
+        for (size_t i = 0; i < pos; i++) {
+            curr = curr->next;
+        }
+    } else {
+        curr = lst->lastlink;
+        for (size_t i = lst->nelems - 1; i > pos; i--) {
+            curr = curr->prev;
+        }
+    }
+    return curr;
+}
+
+static void link_link (IntrusiveList * lst, Link * prev, Link * link, Link * next) {
+    // link in between prev and next, either of which may be NULL
+    link->prev = prev;
+    link->next = next;
+    if (prev == NULL) {
+        lst->firstlink = link;
+    } else {
+        prev->next = link;
+    }
+    if (next == NULL) {
+        lst->lastlink = link;
+    } else {
+        next->prev = link;
+    }
+    lst->nelems++;
+}
+
+void illist__append (IntrusiveList * lst, llist__Link * link) {
+    link_link(lst, lst->lastlink, link, NULL);
+}
+
+IntrusiveList * illist__create (void) {
+    IntrusiveList * lst = malloc(sizeof(IntrusiveList) * 1);
+    if (lst == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the intrusive linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    lst->nelems = 0;
+    lst->firstlink = NULL;
+    lst->lastlink = NULL;
+    return lst;
+}
+
+void illist__delete (const bool global, IntrusiveList * lst, bool (*filter)(llist__Link *)) {
+    Link * curr = lst->firstlink;
+    while (curr != NULL) {
+        Link * next = curr->next;
+        if (filter(curr)) {
+            illist__unlink(lst, curr);
+            if (!global) return;
+        }
+        curr = next;
+    }
+}
+
+void illist__destroy (IntrusiveList ** lst) {
+    Link * curr = (*lst)->firstlink;
+    while (curr != NULL) {
+        Link * next = curr->next;
+        curr->next = NULL;
+        curr->prev = NULL;
+        curr = next;
+    }
+    free(*lst);
+    *lst = NULL;
+}
+
+llist__Link * illist__first (const IntrusiveList * lst) {
+    return lst->firstlink;
+}
+
+llist__Link * illist__get (const size_t pos, const IntrusiveList * lst) {
+    return link_at(lst, pos);
+}
+
+size_t illist__get_length (const IntrusiveList * lst) {
+    return lst->nelems;
+}
+
+void illist__insert (const size_t pos, llist__Link * link, IntrusiveList * lst) {
+    assert(pos <= lst->nelems && "Can't insert link past the end of the list\n");
+    if (pos == lst->nelems) {
+        link_link(lst, lst->lastlink, link, NULL);
+    } else {
+        Link * next = link_at(lst, pos);
+        link_link(lst, next->prev, link, next);
+    }
+}
+
+void illist__insert_after (IntrusiveList * lst, llist__Link * prev, llist__Link * link) {
+    link_link(lst, prev, link, prev == NULL ? lst->firstlink : prev->next);
+}
+
+llist__Link * illist__last (const IntrusiveList * lst) {
+    return lst->lastlink;
+}
+
+llist__Link * illist__next (const llist__Link * link) {
+    return link->next;
+}
+
+llist__Link * illist__pop_back (IntrusiveList * lst) {
+    assert(lst->nelems > 0 && "Can't pop a link from an empty list\n");
+    Link * link = lst->lastlink;
+    illist__unlink(lst, link);
+    return link;
+}
+
+llist__Link * illist__pop_front (IntrusiveList * lst) {
+    assert(lst->nelems > 0 && "Can't pop a link from an empty list\n");
+    Link * link = lst->firstlink;
+    illist__unlink(lst, link);
+    return link;
+}
+
+void illist__prepend (IntrusiveList * lst, llist__Link * link) {
+    link_link(lst, NULL, link, lst->firstlink);
+}
+
+llist__Link * illist__prev (const llist__Link * link) {
+    return link->prev;
+}
+
+void illist__print (const IntrusiveList * lst, const llist__Printers * printers, FILE * fd) {
+
+    // -- print preamble
+    if (printers == NULL || printers->pre == NULL) {
+        fprintf(fd, "[");
+    } else {
+        printers->pre(fd, lst->nelems);
+    }
+
+    // -- print each elem
+    Link * curr = lst->firstlink;
+    size_t i = 0;
+    while (curr != NULL) {
+        if (printers == NULL || printers->elem == NULL) {
+            fprintf(fd, "%p%s", (void *) curr, curr->next == NULL ? "" : ", ");
+        } else {
+            printers->elem(fd, i, lst->nelems, (void *) curr);
+        }
+        curr = curr->next;
+        i++;
+    }
+
+    // -- print postamble
+    if (printers == NULL || printers->post == NULL) {
+        fprintf(fd, "]\n");
+    } else {
+        printers->post(fd, lst->nelems);
+    }
+}
+
+llist__Link * illist__remove (const size_t pos, IntrusiveList * lst) {
+    assert(pos < lst->nelems && "Can't remove link past the end of the list\n");
+    Link * link = link_at(lst, pos);
+    illist__unlink(lst, link);
+    return link;
+}
+
+void illist__unlink (IntrusiveList * lst, llist__Link * link) {
+    assert(lst->nelems > 0 && "Can't unlink a link from an empty list\n");
+    if (link->prev == NULL) {
+        lst->firstlink = link->next;
+    } else {
+        link->prev->next = link->next;
+    }
+    if (link->next == NULL) {
+        lst->lastlink = link->prev;
+    } else {
+        link->next->prev = link->prev;
+    }
+    link->next = NULL;
+    link->prev = NULL;
+    lst->nelems--;
+}
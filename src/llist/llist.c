@@ -1,105 +1,2296 @@
+#define _DEFAULT_SOURCE
 #include "llist/llist.h"
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <threads.h>
+#include <time.h>
+#include <unistd.h>
+
+#define INDEX_MAXLEVEL 32
+
+#define WRITE_BUFSIZE (256 * 1024)
+
+#define WRITE_MAXELEM 64
+
+#define SNAPSHOT_MAGIC "LLSNAP01"
+
+#define SNAPSHOT_ALIGN 16
+
+#define SNAPSHOT_RAW_PAYLOADS 1
+
+#define SEGMENT_MINLEN 1024
+
+#define SEGMENT_MAXCOUNT 1024
+
+#define KEYS_MINSLOTS 16
+
+#define LOCALITY_MAXSTRIDE 64
+
+#if defined(__GNUC__)
+#define PREFETCH(p) __builtin_prefetch((p))
+#else
+#define PREFETCH(p) ((void) 0)
+#endif
+
+#define WHERE_BATCH 16
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WHERE_X86 1
+#include <immintrin.h>
+#else
+#define WHERE_X86 0
+#endif
 
 typedef struct node Node;
 
 struct node {
     void * payload;
     struct node * next;
+    struct node * prev;
 };
 
+typedef struct lane Lane;
+
+typedef struct slab Slab;
+
+typedef struct block Block;
+
+typedef struct {
+    char * buf;
+    size_t size;
+    size_t len;
+    int fd;
+    bool ok;
+} Sink;
+
+struct lane {
+    Node * node;
+    struct lane * next;
+    struct lane * down;
+    size_t span;
+};
+
+typedef struct {
+    bool stale;
+    size_t nlevels;
+    uint64_t seed;
+    llist__Allocator allocator;
+    Lane heads[INDEX_MAXLEVEL];
+} Index;
+
+struct slab {
+    struct slab * next;
+    Node nodes[];
+};
+
+struct block {
+    size_t nnodes;
+    size_t nlive;
+    size_t nrefs;
+    Node * freelist;
+    Node nodes[];
+};
+
+typedef struct {
+    uint64_t generation;
+    size_t nsegments;
+    Node * starts[];
+} Segments;
+
+typedef struct {
+    uint64_t hash;
+    Node * node;
+} Slot;
+
+typedef struct {
+    bool stale;
+    size_t nslots;
+    size_t nkeys;
+    unsigned int shift;
+    llist__KeyOps ops;
+    llist__Allocator allocator;
+    Slot * slots;
+} Keys;
+
+typedef struct {
+    bool valid;
+    uint64_t generation;
+    size_t distance;
+    bool payloads;
+    size_t nnodes;
+    size_t capacity;
+    llist__Allocator allocator;
+    Node ** nodes;
+} Lookahead;
+
+typedef union {
+    int i[WHERE_BATCH];
+    float f[WHERE_BATCH];
+} Fields;
+
+typedef uint64_t (*WhereKernel)(const llist__Where * where, const Fields * fields, size_t n);
+
+typedef struct {
+    Lookahead * la;
+    bool replay;
+    bool payloads;
+    size_t i;
+    size_t nkept;
+} Walk;
+
 struct llist {
     size_t nelems;
     Node * firstnode;
+    Node * lastnode;
+    llist__NodePool * pool;
+    llist__Allocator allocator;
+    Node * spares;
+    size_t nspares;
+    size_t maxspares;
+    Index * index;
+    uint64_t generation;
+    Segments * segments;
+    Keys * keys;
+    Lookahead * lookahead;
+    Block ** blocks;
+    size_t nblocks;
+    size_t capblocks;
+    Block * home;
+#ifdef LLIST_STATS
+    llist__Stats stats;
+#endif
+};
+
+typedef struct job Job;
+
+struct job {
+    LinkedList * lst;
+    const Segments * segments;
+    atomic_size_t next;
+    void (*run)(Job * job, size_t iseg, Node * first, size_t pos, size_t len);
+    void (*fn)(void *, void *);
+    bool (*pred)(void *, void *);
+    const llist__Reducer * reducer;
+    void * ctx;
+    unsigned char * flags;
+    char * partials;
+};
+
+struct llist__node_pool {
+    size_t nlists;
+    size_t nodes_per_slab;
+    Slab * slabs;
+    Node * freelist;
+    Node * bump;
+    Node * bumpend;
+    void * mapping;
+    size_t mapsize;
 };
 
-void llist__append (LinkedList * lst, void * item) {
-    size_t n = llist__get_length(lst);
-    llist__insert(n, item, lst);
+typedef struct {
+    char magic[8];
+    uint32_t byteorder;
+    uint32_t ptrsize;
+    uint64_t flags;
+    uint64_t nelems;
+    uint64_t nodes_offset;
+    uint64_t payloads_offset;
+    uint64_t payloads_size;
+    uint64_t reserved;
+} SnapshotHeader;
+
+typedef struct {
+    uint64_t payload;
+    uint64_t next;
+    uint64_t prev;
+} SnapshotNode;
+
+// With LLIST_STATS defined, the public operations time themselves and
+// count the nodes they walk, both in the list they operate on and in
+// process-wide totals. The nodes counter is thread local, so that
+// helpers deep down the call chain don't need to know which list they
+// work for. Without LLIST_STATS, the macros expand to nothing.
+
+#ifdef LLIST_STATS
+
+typedef struct {
+    atomic_uint_least64_t count;
+    atomic_uint_least64_t nodes;
+    atomic_uint_least64_t latency[LLIST_STATS_NBUCKETS];
+} SharedOpStats;
+
+static struct {
+    SharedOpStats ops[LLIST_STATS_NOPS];
+    atomic_uint_least64_t nallocs;
+    atomic_uint_least64_t nfrees;
+} stats_global;
+
+static thread_local uint64_t stats_nodes = 0;
+
+static uint64_t stats_begin (void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    stats_nodes = 0;
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+static void stats_end (LinkedList * lst, llist__StatsOp op, uint64_t t0) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t elapsed = (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec - t0;
+    size_t bucket = 0;
+    while (elapsed > 1 && bucket < LLIST_STATS_NBUCKETS - 1) {
+        elapsed >>= 1;
+        bucket++;
+    }
+    lst->stats.ops[op].count++;
+    lst->stats.ops[op].nodes += stats_nodes;
+    lst->stats.ops[op].latency[bucket]++;
+    atomic_fetch_add_explicit(&stats_global.ops[op].count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats_global.ops[op].nodes, stats_nodes, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats_global.ops[op].latency[bucket], 1, memory_order_relaxed);
+}
+
+static void stats_alloc (LinkedList * lst) {
+    lst->stats.nallocs++;
+    atomic_fetch_add_explicit(&stats_global.nallocs, 1, memory_order_relaxed);
+}
+
+static void stats_free (LinkedList * lst, size_t n) {
+    lst->stats.nfrees += n;
+    atomic_fetch_add_explicit(&stats_global.nfrees, n, memory_order_relaxed);
+}
+
+#define STATS_BEGIN() uint64_t stats_t0 = stats_begin()
+#define STATS_END(lst, op) stats_end((lst), (op), stats_t0)
+#define STATS_NODES(n) (stats_nodes += (n))
+#define STATS_ALLOC(lst) stats_alloc(lst)
+#define STATS_FREE(lst, n) stats_free((lst), (n))
+
+#else
+
+#define STATS_BEGIN() ((void) 0)
+#define STATS_END(lst, op) ((void) 0)
+#define STATS_NODES(n) ((void) 0)
+#define STATS_ALLOC(lst) ((void) 0)
+#define STATS_FREE(lst, n) ((void) 0)
+
+#endif
+
+static void * mem_alloc (const llist__Allocator * allocator, size_t size) {
+    return allocator->alloc == NULL ? malloc(size) : allocator->alloc(size, allocator->ctx);
+}
+
+static void mem_free (const llist__Allocator * allocator, void * p, size_t size) {
+    if (allocator->free == NULL) {
+        free(p);
+    } else {
+        allocator->free(p, size, allocator->ctx);
+    }
+}
+
+// Compacting a list moves its nodes into a block of their own, see
+// llist__compact. A block is registered with every list that may hold
+// some of its nodes, and is freed once none of those lists refers to it
+// anymore. Registries are sorted by address, such that finding the
+// block of a node takes a binary search; they shrink back to a single
+// block whenever their list is compacted. Nodes released to the block
+// of a list's latest compaction, its home, are reused before any others.
+
+static size_t blocks_search (const LinkedList * lst, uintptr_t p) {
+    // the number of blocks that start at or before p
+    size_t lo = 0;
+    size_t hi = lst->nblocks;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if ((uintptr_t) &lst->blocks[mid]->nodes[0] <= p) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static Block * block_of (const LinkedList * lst, const Node * node, size_t * i) {
+    uintptr_t p = (uintptr_t) node;
+    size_t n = blocks_search(lst, p);
+    if (n == 0) return NULL;
+    Block * block = lst->blocks[n - 1];
+    if (p >= (uintptr_t) &block->nodes[block->nnodes]) return NULL;
+    *i = n - 1;
+    return block;
+}
+
+static bool blocks_try_reserve (LinkedList * lst) {
+    // make room for one more block
+    if (lst->nblocks < lst->capblocks) return true;
+    size_t capacity = lst->capblocks == 0 ? 4 : 2 * lst->capblocks;
+    Block ** blocks = mem_alloc(&lst->allocator, sizeof(Block *) * capacity);
+    if (blocks == NULL) return false;
+    if (lst->blocks != NULL) {
+        memcpy(blocks, lst->blocks, sizeof(Block *) * lst->nblocks);
+        mem_free(&lst->allocator, lst->blocks, sizeof(Block *) * lst->capblocks);
+    }
+    lst->blocks = blocks;
+    lst->capblocks = capacity;
+    return true;
+}
+
+static void blocks_add (LinkedList * lst, Block * block) {
+    size_t i = blocks_search(lst, (uintptr_t) &block->nodes[0]);
+    if (i > 0 && lst->blocks[i - 1] == block) return;
+    if (!blocks_try_reserve(lst)) {
+        fprintf(stderr, "Something went wrong allocating memory for compacted blocks of linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    memmove(&lst->blocks[i + 1], &lst->blocks[i], sizeof(Block *) * (lst->nblocks - i));
+    lst->blocks[i] = block;
+    lst->nblocks++;
+    block->nrefs++;
+}
+
+static void blocks_drop (LinkedList * lst, const size_t i) {
+    Block * block = lst->blocks[i];
+    memmove(&lst->blocks[i], &lst->blocks[i + 1], sizeof(Block *) * (lst->nblocks - i - 1));
+    lst->nblocks--;
+    if (lst->nblocks == 0) {
+        mem_free(&lst->allocator, lst->blocks, sizeof(Block *) * lst->capblocks);
+        lst->blocks = NULL;
+        lst->capblocks = 0;
+    }
+    if (lst->home == block) {
+        lst->home = NULL;
+    }
+    block->nrefs--;
+    if (block->nrefs == 0) {
+        assert(block->nlive == 0 && "Expected no nodes of a block to be in use when freeing it\n");
+        mem_free(&lst->allocator, block, sizeof(Block) + sizeof(Node) * block->nnodes);
+    }
+}
+
+static void blocks_share (LinkedList * dst, const LinkedList * src) {
+    // nodes about to move from src to dst may come from any of its blocks
+    for (size_t i = 0; i < src->nblocks; i++) {
+        blocks_add(dst, src->blocks[i]);
+    }
+}
+
+static Node * node_acquire (LinkedList * lst) {
+    Block * home = lst->home;
+    if (home != NULL && home->freelist != NULL) {
+        Node * node = home->freelist;
+        home->freelist = node->next;
+        home->nlive++;
+        return node;
+    }
+    if (lst->pool == NULL) {
+        return mem_alloc(&lst->allocator, sizeof(Node));
+    }
+    llist__NodePool * pool = lst->pool;
+    if (pool->freelist != NULL) {
+        Node * node = pool->freelist;
+        pool->freelist = node->next;
+        return node;
+    }
+    if (pool->bump == pool->bumpend) {
+        Slab * slab = malloc(sizeof(Slab) + sizeof(Node) * pool->nodes_per_slab);
+        if (slab == NULL) return NULL;
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->bump = &slab->nodes[0];
+        pool->bumpend = &slab->nodes[pool->nodes_per_slab];
+    }
+    return pool->bump++;
+}
+
+static void node_release (LinkedList * lst, Node * node) {
+    size_t i = 0;
+    Block * block = lst->nblocks == 0 ? NULL : block_of(lst, node, &i);
+    if (block != NULL) {
+        node->next = block->freelist;
+        block->freelist = node;
+        block->nlive--;
+        if (block->nlive == 0) {
+            blocks_drop(lst, i);
+        }
+        return;
+    }
+    if (lst->pool == NULL) {
+        mem_free(&lst->allocator, node, sizeof(Node));
+        return;
+    }
+    node->next = lst->pool->freelist;
+    lst->pool->freelist = node;
+}
+
+static Node * node_take (LinkedList * lst) {
+    // spare nodes come first, see llist__reserve
+    if (lst->spares != NULL) {
+        Node * node = lst->spares;
+        lst->spares = node->next;
+        lst->nspares--;
+        return node;
+    }
+    return node_acquire(lst);
+}
+
+static Node * node_try_alloc (LinkedList * lst) {
+    // returns NULL when memory runs out, unlike node_alloc
+    Node * node = node_take(lst);
+    if (node != NULL) {
+        STATS_ALLOC(lst);
+    }
+    return node;
+}
+
+static Node * node_alloc (LinkedList * lst) {
+    Node * node = node_try_alloc(lst);
+    if (node == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for new node in linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    return node;
+}
+
+static void node_free (LinkedList * lst, Node * node) {
+    STATS_FREE(lst, 1);
+    if (lst->nspares < lst->maxspares) {
+        node->next = lst->spares;
+        lst->spares = node;
+        lst->nspares++;
+        return;
+    }
+    node_release(lst, node);
+}
+
+static void spares_release (LinkedList * lst) {
+    while (lst->spares != NULL) {
+        Node * node = lst->spares;
+        lst->spares = node->next;
+        node_release(lst, node);
+    }
+    lst->nspares = 0;
+}
+
+// The keyed index is an open addressing hash table with linear probing
+// that maps the key of every item to its node. Slots cache the hash of
+// their key, so probing rarely calls equal and growing the table never
+// calls hash. Nodes that are linked or unlinked one at a time enter or
+// leave the table right away, whereas operations that move whole chains
+// between lists mark the table as stale, after which the next keyed
+// operation rebuilds it in one pass.
+
+static const void * keys_key (const Keys * keys, const void * item) {
+    return keys->ops.key == NULL ? item : keys->ops.key(item, keys->ops.ctx);
+}
+
+static size_t keys_home (const Keys * keys, uint64_t hash) {
+    // fibonacci hashing, so that hashes which only differ in their high
+    // bits don't all land in the same slot
+    return (size_t) ((hash * 0x9e3779b97f4a7c15) >> keys->shift);
+}
+
+static void keys_place (Keys * keys, uint64_t hash, Node * node) {
+    size_t mask = keys->nslots - 1;
+    size_t i = keys_home(keys, hash);
+    while (keys->slots[i].node != NULL) {
+        i = (i + 1) & mask;
+    }
+    keys->slots[i] = (Slot) { .hash = hash, .node = node };
+    keys->nkeys++;
+}
+
+static bool keys_try_resize (Keys * keys, size_t nslots) {
+    // leaves the table as it was when memory runs out
+    Slot * slots = mem_alloc(&keys->allocator, sizeof(Slot) * nslots);
+    if (slots == NULL) return false;
+    memset(slots, 0, sizeof(Slot) * nslots);
+    Slot * old = keys->slots;
+    size_t nold = keys->nslots;
+    keys->slots = slots;
+    keys->nslots = nslots;
+    keys->nkeys = 0;
+    keys->shift = 64;
+    for (size_t n = nslots; n > 1; n >>= 1) {
+        keys->shift--;
+    }
+    for (size_t i = 0; i < nold; i++) {
+        if (old[i].node != NULL) {
+            keys_place(keys, old[i].hash, old[i].node);
+        }
+    }
+    if (old != NULL) {
+        mem_free(&keys->allocator, old, sizeof(Slot) * nold);
+    }
+    return true;
+}
+
+static void keys_resize (Keys * keys, size_t nslots) {
+    if (!keys_try_resize(keys, nslots)) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list keys.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static bool keys_full (const Keys * keys) {
+    // keep the load factor at or below one half
+    return 2 * (keys->nkeys + 1) > keys->nslots;
+}
+
+static size_t keys_lookup (const Keys * keys, const void * key, uint64_t hash) {
+    // the slot that holds key, or SIZE_MAX if there is none
+    size_t mask = keys->nslots - 1;
+    for (size_t i = keys_home(keys, hash); keys->slots[i].node != NULL; i = (i + 1) & mask) {
+        if (keys->slots[i].hash == hash &&
+            keys->ops.equal(key, keys_key(keys, keys->slots[i].node->payload), keys->ops.ctx)) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+static void keys_put (Keys * keys, Node * node) {
+    if (keys_full(keys)) {
+        keys_resize(keys, 2 * keys->nslots);
+    }
+    const void * key = keys_key(keys, node->payload);
+    uint64_t hash = keys->ops.hash(key, keys->ops.ctx);
+    assert(keys_lookup(keys, key, hash) == SIZE_MAX && "Expected the keys of a keyed linked list to be unique\n");
+    keys_place(keys, hash, node);
+}
+
+static void keys_erase (Keys * keys, Node * node) {
+    // backward shift deletion: members of the probe run that follows the
+    // hole move into it if that doesn't put them before their home slot,
+    // so the table never needs tombstones
+    size_t mask = keys->nslots - 1;
+    size_t i = keys_home(keys, keys->ops.hash(keys_key(keys, node->payload), keys->ops.ctx));
+    while (keys->slots[i].node != node) {
+        assert(keys->slots[i].node != NULL && "Expected the key of an item not to change while it is keyed\n");
+        i = (i + 1) & mask;
+    }
+    for (size_t j = (i + 1) & mask; keys->slots[j].node != NULL; j = (j + 1) & mask) {
+        size_t home = keys_home(keys, keys->slots[j].hash);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            keys->slots[i] = keys->slots[j];
+            i = j;
+        }
+    }
+    keys->slots[i].node = NULL;
+    keys->nkeys--;
+}
+
+static void keys_clear (Keys * keys) {
+    if (keys->slots != NULL) {
+        mem_free(&keys->allocator, keys->slots, sizeof(Slot) * keys->nslots);
+    }
+    keys->slots = NULL;
+    keys->nslots = 0;
+    keys->nkeys = 0;
+}
+
+static bool keys_try_build (LinkedList * lst) {
+    // sized up front, such that putting the keys never grows the table
+    Keys * keys = lst->keys;
+    size_t nslots = KEYS_MINSLOTS;
+    while (nslots < 2 * (lst->nelems + 1)) {
+        nslots *= 2;
+    }
+    keys_clear(keys);
+    if (!keys_try_resize(keys, nslots)) return false;
+    for (Node * curr = lst->firstnode; curr != NULL; curr = curr->next) {
+        keys_put(keys, curr);
+    }
+    STATS_NODES(lst->nelems);
+    keys->stale = false;
+    return true;
+}
+
+static void keys_build (LinkedList * lst) {
+    if (!keys_try_build(lst)) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list keys.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static bool keys_live (const LinkedList * lst) {
+    return lst->keys != NULL && !lst->keys->stale;
+}
+
+static void keys_invalidate (LinkedList * lst) {
+    if (lst->keys != NULL) {
+        lst->keys->stale = true;
+    }
+}
+
+static Node * keys_find (LinkedList * lst, const void * key) {
+    assert(lst->keys != NULL && "Expected a keyed linked list\n");
+    if (lst->keys->stale) {
+        keys_build(lst);
+    }
+    Keys * keys = lst->keys;
+    size_t i = keys_lookup(keys, key, keys->ops.hash(key, keys->ops.ctx));
+    return i == SIZE_MAX ? NULL : keys->slots[i].node;
+}
+
+static void node_link (LinkedList * lst, Node * prev, Node * node, Node * next) {
+    // link node in between prev and next, either of which may be NULL
+    node->prev = prev;
+    node->next = next;
+    if (prev == NULL) {
+        lst->firstnode = node;
+    } else {
+        prev->next = node;
+    }
+    if (next == NULL) {
+        lst->lastnode = node;
+    } else {
+        next->prev = node;
+    }
+    lst->nelems++;
+    lst->generation++;
+    if (keys_live(lst)) {
+        keys_put(lst->keys, node);
+    }
+}
+
+static Node * node_at (const LinkedList * lst, size_t pos) {
+    // walk from whichever end of the list is closest to pos
+    assert(pos < lst->nelems && "Can't get node past the end of the list\n");
+    Node * curr = NULL;
+    if (pos < lst->nelems / 2) {
+        curr = lst->firstnode;
+        for (size_t i = 0; i < pos; i++) {
+            curr = curr->next;
+        }
+        STATS_NODES(pos);
+    } else {
+        curr = lst->lastnode;
+        for (size_t i = lst->nelems - 1; i > pos; i--) {
+            curr = curr->prev;
+        }
+        STATS_NODES(lst->nelems - 1 - pos);
+    }
+    return curr;
+}
+
+static void node_unlink (LinkedList * lst, Node * node) {
+    if (keys_live(lst)) {
+        keys_erase(lst->keys, node);
+    }
+    if (node->prev == NULL) {
+        lst->firstnode = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if (node->next == NULL) {
+        lst->lastnode = node->prev;
+    } else {
+        node->next->prev = node->prev;
+    }
+    node->prev = NULL;
+    node->next = NULL;
+    lst->nelems--;
+    lst->generation++;
+}
+
+// The index is an order-statistic skip list whose lanes sit on top of
+// the chain of nodes. Each lane records its span, i.e. the number of
+// nodes between its own node and the node of the next lane on the same
+// level (or the end of the list). Nodes are ranked 1..nelems; the heads
+// have rank 0. Positional operations keep the index up to date, whereas
+// operations that relink nodes wholesale merely mark the index as stale,
+// after which the next positional operation rebuilds it in one pass.
+
+static Lane * lane_try_alloc (Index * index, Node * node, Lane * next, Lane * down, size_t span) {
+    Lane * lane = mem_alloc(&index->allocator, sizeof(Lane));
+    if (lane == NULL) return NULL;
+    lane->node = node;
+    lane->next = next;
+    lane->down = down;
+    lane->span = span;
+    return lane;
+}
+
+static void index_clear (Index * index) {
+    for (size_t l = 0; l < INDEX_MAXLEVEL; l++) {
+        Lane * curr = index->heads[l].next;
+        while (curr != NULL) {
+            Lane * tmp = curr;
+            curr = curr->next;
+            mem_free(&index->allocator, tmp, sizeof(Lane));
+        }
+        index->heads[l].node = NULL;
+        index->heads[l].next = NULL;
+        index->heads[l].down = l == 0 ? NULL : &index->heads[l - 1];
+        index->heads[l].span = 0;
+    }
+    index->nlevels = 1;
+}
+
+static size_t index_random_height (Index * index) {
+    // each level holds roughly a quarter of the lanes of the level below
+    index->seed ^= index->seed << 13;
+    index->seed ^= index->seed >> 7;
+    index->seed ^= index->seed << 17;
+    uint64_t bits = index->seed;
+    size_t height = 0;
+    while ((bits & 3) == 0 && height < INDEX_MAXLEVEL) {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+static bool index_try_build (LinkedList * lst) {
+    // running out of memory halfway leaves the index empty and stale
+    Index * index = lst->index;
+    Lane * tails[INDEX_MAXLEVEL];
+    size_t tailranks[INDEX_MAXLEVEL];
+    index_clear(index);
+    for (size_t l = 0; l < INDEX_MAXLEVEL; l++) {
+        tails[l] = &index->heads[l];
+        tailranks[l] = 0;
+    }
+    size_t rank = 0;
+    for (Node * curr = lst->firstnode; curr != NULL; curr = curr->next) {
+        rank++;
+        size_t height = index_random_height(index);
+        Lane * below = NULL;
+        for (size_t l = 0; l < height; l++) {
+            Lane * lane = lane_try_alloc(index, curr, NULL, below, 0);
+            if (lane == NULL) {
+                index_clear(index);
+                index->stale = true;
+                return false;
+            }
+            tails[l]->span = rank - tailranks[l];
+            tails[l]->next = lane;
+            tails[l] = lane;
+            tailranks[l] = rank;
+            below = lane;
+        }
+        if (height > index->nlevels) {
+            index->nlevels = height;
+        }
+    }
+    for (size_t l = 0; l < INDEX_MAXLEVEL; l++) {
+        tails[l]->span = rank - tailranks[l];
+    }
+    STATS_NODES(rank);
+    index->stale = false;
+    return true;
+}
+
+static void index_build (LinkedList * lst) {
+    if (!index_try_build(lst)) {
+        fprintf(stderr, "Something went wrong allocating memory for new lane in linked list index.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void index_find (Index * index, size_t limit, Lane ** update, size_t * ranks) {
+    // find the last lane on every level whose rank is less than limit
+    Lane * curr = &index->heads[index->nlevels - 1];
+    size_t rank = 0;
+    for (size_t l = index->nlevels; l-- > 0;) {
+        while (curr->next != NULL && rank + curr->span < limit) {
+            rank += curr->span;
+            curr = curr->next;
+            STATS_NODES(1);
+        }
+        update[l] = curr;
+        ranks[l] = rank;
+        curr = curr->down;
+    }
+}
+
+static Node * index_walk (const LinkedList * lst, const Lane * lane, size_t rank, size_t target) {
+    // walk the chain from the node under lane to the node ranked target
+    if (target == 0) return NULL;
+    Node * curr = lane->node == NULL ? lst->firstnode : lane->node;
+    for (size_t r = lane->node == NULL ? 1 : rank; r < target; r++) {
+        curr = curr->next;
+        STATS_NODES(1);
+    }
+    return curr;
+}
+
+static bool index_live (const LinkedList * lst) {
+    return lst->index != NULL && !lst->index->stale;
+}
+
+static void index_refresh (LinkedList * lst) {
+    if (lst->index != NULL && lst->index->stale) {
+        index_build(lst);
+    }
+}
+
+static void index_invalidate (LinkedList * lst) {
+    // called by every operation that relinks nodes wholesale, so this is
+    // also where cached segmentations go out of date
+    lst->generation++;
+    if (lst->index != NULL) {
+        lst->index->stale = true;
+    }
+}
+
+static bool index_try_insert (LinkedList * lst, const size_t pos, Node * node) {
+    // the lanes are allocated up front, such that running out of memory
+    // leaves both the index and the chain as they were
+    Index * index = lst->index;
+    size_t height = index_random_height(index);
+    Lane * lanes[INDEX_MAXLEVEL];
+    for (size_t l = 0; l < height; l++) {
+        lanes[l] = mem_alloc(&index->allocator, sizeof(Lane));
+        if (lanes[l] == NULL) {
+            while (l-- > 0) {
+                mem_free(&index->allocator, lanes[l], sizeof(Lane));
+            }
+            return false;
+        }
+    }
+
+    Lane * update[INDEX_MAXLEVEL] = { NULL };
+    size_t ranks[INDEX_MAXLEVEL] = { 0 };
+    index_find(index, pos + 1, update, ranks);
+
+    Node * prev = index_walk(lst, update[0], ranks[0], pos);
+    node_link(lst, prev, node, prev == NULL ? lst->firstnode : prev->next);
+
+    for (size_t l = index->nlevels; l < height; l++) {
+        update[l] = &index->heads[l];
+        update[l]->span = lst->nelems - 1;
+        ranks[l] = 0;
+    }
+    if (height > index->nlevels) {
+        index->nlevels = height;
+    }
+    Lane * below = NULL;
+    for (size_t l = 0; l < height; l++) {
+        Lane * lane = lanes[l];
+        *lane = (Lane) { .node = node, .next = update[l]->next, .down = below,
+                         .span = update[l]->span - (pos - ranks[l]) };
+        update[l]->next = lane;
+        update[l]->span = pos - ranks[l] + 1;
+        below = lane;
+    }
+    for (size_t l = height; l < index->nlevels; l++) {
+        update[l]->span++;
+    }
+    return true;
+}
+
+static void index_insert (LinkedList * lst, const size_t pos, Node * node) {
+    if (!index_try_insert(lst, pos, node)) {
+        fprintf(stderr, "Something went wrong allocating memory for new lane in linked list index.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static Node * index_remove (LinkedList * lst, const size_t pos) {
+    Index * index = lst->index;
+    Lane * update[INDEX_MAXLEVEL] = { NULL };
+    size_t ranks[INDEX_MAXLEVEL] = { 0 };
+    index_find(index, pos + 1, update, ranks);
+
+    Node * prev = index_walk(lst, update[0], ranks[0], pos);
+    Node * node = prev == NULL ? lst->firstnode : prev->next;
+    for (size_t l = 0; l < index->nlevels; l++) {
+        Lane * lane = update[l]->next;
+        if (lane != NULL && lane->node == node) {
+            update[l]->span += lane->span - 1;
+            update[l]->next = lane->next;
+            mem_free(&index->allocator, lane, sizeof(Lane));
+        } else {
+            update[l]->span--;
+        }
+    }
+    while (index->nlevels > 1 && index->heads[index->nlevels - 1].next == NULL) {
+        index->nlevels--;
+    }
+    node_unlink(lst, node);
+    return node;
+}
+
+static void node_insert (LinkedList * lst, const size_t pos, Node * node, void * item) {
+    node->payload = item;
+
+    if (lst->index != NULL && (index_live(lst) || (pos > 0 && pos < lst->nelems))) {
+        index_refresh(lst);
+        index_insert(lst, pos, node);
+        return;
+    }
+
+    // inserting at the end is O(1) thanks to lastnode, anywhere else
+    // walks from the nearest end of the list
+    Node * next = pos == lst->nelems ? NULL : node_at(lst, pos);
+    Node * prev = next == NULL ? lst->lastnode : next->prev;
+    node_link(lst, prev, node, next);
+}
+
+static bool node_try_insert (LinkedList * lst, const size_t pos, Node * node, void * item) {
+    // like node_insert, but returns false and leaves lst unchanged when
+    // the index or the keyed index can't grow. A stale index isn't
+    // rebuilt here, as that could run out of memory halfway; inserting
+    // walks the chain instead, and the index stays stale
+    if (keys_live(lst) && keys_full(lst->keys) && !keys_try_resize(lst->keys, 2 * lst->keys->nslots)) {
+        return false;
+    }
+    node->payload = item;
+    if (index_live(lst)) {
+        return index_try_insert(lst, pos, node);
+    }
+    Node * next = pos == lst->nelems ? NULL : node_at(lst, pos);
+    Node * prev = next == NULL ? lst->lastnode : next->prev;
+    node_link(lst, prev, node, next);
+    return true;
+}
+
+static void list_check_source (const LinkedList * a, const LinkedList * b) {
+    // nodes that move between lists are eventually released by the list
+    // they end up in, which must hand them back to where they came from
+    if (a->pool != b->pool || a->allocator.alloc != b->allocator.alloc || a->allocator.free != b->allocator.free ||
+        a->allocator.ctx != b->allocator.ctx) {
+        fprintf(stderr, "Can't move nodes between linked lists that draw them from different pools or allocators.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static size_t locality_count (const LinkedList * lst) {
+    // the number of nodes whose successor follows them closely in memory
+    size_t nnear = 0;
+    if (lst->nelems < 2) return nnear;
+    for (const Node * curr = lst->firstnode; curr->next != NULL; curr = curr->next) {
+        uintptr_t here = (uintptr_t) curr;
+        uintptr_t next = (uintptr_t) curr->next;
+        if (next > here && next - here < LOCALITY_MAXSTRIDE) {
+            nnear++;
+        }
+    }
+    return nnear;
+}
+
+static double locality_ratio (const LinkedList * lst, size_t nnear) {
+    return lst->nelems < 2 ? 1.0 : (double) nnear / (double) (lst->nelems - 1);
+}
+
+static LinkedList * list_try_create (const llist__Allocator * allocator) {
+    static const llist__Allocator system = { .alloc = NULL, .free = NULL, .ctx = NULL };
+    if (allocator == NULL) {
+        allocator = &system;
+    }
+    LinkedList * lst = mem_alloc(allocator, sizeof(LinkedList));
+    if (lst == NULL) return NULL;
+    lst->nelems = 0;
+    lst->firstnode = NULL;
+    lst->lastnode = NULL;
+    lst->pool = NULL;
+    lst->allocator = *allocator;
+    lst->spares = NULL;
+    lst->nspares = 0;
+    // nodes kept as spares are lost to other lists on the same budget,
+    // so lists with an allocator of their own only keep them on request
+    lst->maxspares = allocator->alloc == NULL && allocator->free == NULL ? LLIST_SPARES : 0;
+    lst->index = NULL;
+    lst->generation = 0;
+    lst->segments = NULL;
+    lst->keys = NULL;
+    lst->lookahead = NULL;
+    lst->blocks = NULL;
+    lst->nblocks = 0;
+    lst->capblocks = 0;
+    lst->home = NULL;
+#ifdef LLIST_STATS
+    lst->stats = (llist__Stats) { .nallocs = 0 };
+#endif
+    return lst;
+}
+
+static LinkedList * list_create (const llist__Allocator * allocator) {
+    LinkedList * lst = list_try_create(allocator);
+    if (lst == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    return lst;
+}
+
+static Node * chain_merge (Node * a, Node * b, int (*cmp)(const void *, const void *, void *), void * ctx) {
+    // stable merge of two sorted, NULL-terminated chains; only next links
+    // are maintained, prev links are restored afterwards by chain_adopt
+    Node head = { .next = NULL };
+    Node * tail = &head;
+    while (a != NULL && b != NULL) {
+        if (cmp(a->payload, b->payload, ctx) <= 0) {
+            tail->next = a;
+            a = a->next;
+        } else {
+            tail->next = b;
+            b = b->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a != NULL ? a : b;
+    return head.next;
+}
+
+static void chain_adopt (LinkedList * lst, Node * first, size_t nelems) {
+    // make the chain starting at first the contents of lst, restoring
+    // its prev links and last node along the way
+    lst->firstnode = first;
+    lst->lastnode = NULL;
+    lst->nelems = nelems;
+    for (Node * curr = first; curr != NULL; curr = curr->next) {
+        curr->prev = lst->lastnode;
+        lst->lastnode = curr;
+    }
+    index_invalidate(lst);
+}
+
+// Traversals that prefetch record the address of every node they visit
+// in a lookahead array, see llist__set_prefetch. The next traversal of
+// the same structure replays the array, prefetching the nodes that are
+// a fixed number of steps ahead without chasing pointers to find them,
+// and writes back the addresses of the nodes that it keeps, such that
+// deleting items keeps the array up to date. Any other change to the
+// structure bumps the generation, which sends the next traversal back
+// to recording.
+
+static Walk walk_begin (const LinkedList * lst, bool payloads) {
+    Lookahead * la = lst->lookahead;
+    Walk walk = { .la = la, .replay = false, .payloads = false, .i = 0, .nkept = 0 };
+    if (la == NULL) return walk;
+    walk.replay = la->valid && la->generation == lst->generation && la->nnodes == lst->nelems;
+    walk.payloads = la->payloads && payloads;
+    la->valid = false;
+    if (walk.replay) {
+        // nodes run twice as far ahead as payloads, such that the node
+        // whose payload gets prefetched is already in cache
+        size_t ahead = walk.payloads ? 2 * la->distance : la->distance;
+        for (size_t i = 0; i < ahead && i < la->nnodes; i++) {
+            PREFETCH(la->nodes[i]);
+        }
+    }
+    return walk;
+}
+
+static void walk_step (Walk * walk) {
+    // called once per visited node, before working on it
+    if (!walk->replay) return;
+    Lookahead * la = walk->la;
+    size_t i = walk->i++;
+    if (walk->payloads) {
+        if (i + 2 * la->distance < la->nnodes) {
+            PREFETCH(la->nodes[i + 2 * la->distance]);
+        }
+        if (i + la->distance < la->nnodes) {
+            PREFETCH(la->nodes[i + la->distance]->payload);
+        }
+    } else if (i + la->distance < la->nnodes) {
+        PREFETCH(la->nodes[i + la->distance]);
+    }
+}
+
+static void walk_keep (Walk * walk, Node * node) {
+    // called for every visited node that stays in the list
+    Lookahead * la = walk->la;
+    if (la == NULL) return;
+    if (walk->nkept == la->capacity) {
+        // prefetching is only a hint, so running out of memory merely
+        // stops recording, and the next walk records afresh
+        size_t capacity = la->capacity == 0 ? 64 : 2 * la->capacity;
+        Node ** nodes = mem_alloc(&la->allocator, sizeof(Node *) * capacity);
+        if (nodes == NULL) {
+            walk->la = NULL;
+            return;
+        }
+        if (la->nodes != NULL) {
+            memcpy(nodes, la->nodes, sizeof(Node *) * walk->nkept);
+            mem_free(&la->allocator, la->nodes, sizeof(Node *) * la->capacity);
+        }
+        la->nodes = nodes;
+        la->capacity = capacity;
+    }
+    la->nodes[walk->nkept++] = node;
+}
+
+static void walk_end (const LinkedList * lst, Walk * walk, bool finished) {
+    Lookahead * la = walk->la;
+    if (la == NULL) return;
+    if (!finished) {
+        // the nodes a recording walk didn't get to were never recorded,
+        // whereas a replaying walk still has their addresses
+        if (!walk->replay) return;
+        memmove(&la->nodes[walk->nkept], &la->nodes[walk->i], sizeof(Node *) * (la->nnodes - walk->i));
+        walk->nkept += la->nnodes - walk->i;
+    }
+    la->nnodes = walk->nkept;
+    la->generation = lst->generation;
+    la->valid = true;
+}
+
+// llist__delete_where gathers the fields of up to WHERE_BATCH payloads
+// into an array and hands it to a kernel that returns a bitmask of the
+// matching lanes. Batches are kept small, such that the loads of one
+// batch's fields overlap with chasing the nodes of the next one within
+// the CPU's out-of-order window. The vector kernels evaluate whole
+// registers, so the last batch may include lanes past n, whose bits the
+// caller masks off.
+
+static size_t where_lowest_bit (uint64_t mask) {
+#if defined(__GNUC__)
+    return (size_t) __builtin_ctzll(mask);
+#else
+    size_t i = 0;
+    while (((mask >> i) & 1) == 0) {
+        i++;
+    }
+    return i;
+#endif
+}
+
+static bool where_match_int (const llist__Where * where, int x) {
+    switch (where->op) {
+        case LLIST_WHERE_EQ:
+            return x == where->value.i;
+        case LLIST_WHERE_LT:
+            return x < where->value.i;
+        case LLIST_WHERE_GT:
+            return x > where->value.i;
+        case LLIST_WHERE_RANGE:
+            return where->value.i <= x && x <= where->upper.i;
+        case LLIST_WHERE_IN:
+            for (size_t k = 0; k < where->nset; k++) {
+                if (x == where->set[k].i) return true;
+            }
+            return false;
+    }
+    return false;
+}
+
+static bool where_match_float (const llist__Where * where, float x) {
+    switch (where->op) {
+        case LLIST_WHERE_EQ:
+            return x == where->value.f;
+        case LLIST_WHERE_LT:
+            return x < where->value.f;
+        case LLIST_WHERE_GT:
+            return x > where->value.f;
+        case LLIST_WHERE_RANGE:
+            return where->value.f <= x && x <= where->upper.f;
+        case LLIST_WHERE_IN:
+            for (size_t k = 0; k < where->nset; k++) {
+                if (x == where->set[k].f) return true;
+            }
+            return false;
+    }
+    return false;
+}
+
+static uint64_t where_scalar (const llist__Where * where, const Fields * fields, size_t n) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < n; i++) {
+        bool hit = where->type == LLIST_FIELD_INT ? where_match_int(where, fields->i[i])
+                                                  : where_match_float(where, fields->f[i]);
+        mask |= (uint64_t) hit << i;
+    }
+    return mask;
+}
+
+#if WHERE_X86
+
+[[gnu::target("sse2")]]
+static __m128i where_sse2_int (const llist__Where * where, __m128i x) {
+    __m128i value = _mm_set1_epi32(where->value.i);
+    switch (where->op) {
+        case LLIST_WHERE_EQ:
+            return _mm_cmpeq_epi32(x, value);
+        case LLIST_WHERE_LT:
+            return _mm_cmplt_epi32(x, value);
+        case LLIST_WHERE_GT:
+            return _mm_cmpgt_epi32(x, value);
+        case LLIST_WHERE_RANGE:
+            return _mm_andnot_si128(_mm_or_si128(_mm_cmplt_epi32(x, value),
+                                                 _mm_cmpgt_epi32(x, _mm_set1_epi32(where->upper.i))),
+                                    _mm_set1_epi32(-1));
+        case LLIST_WHERE_IN: {
+            __m128i hit = _mm_setzero_si128();
+            for (size_t k = 0; k < where->nset; k++) {
+                hit = _mm_or_si128(hit, _mm_cmpeq_epi32(x, _mm_set1_epi32(where->set[k].i)));
+            }
+            return hit;
+        }
+    }
+    return _mm_setzero_si128();
+}
+
+[[gnu::target("sse2")]]
+static __m128 where_sse2_float (const llist__Where * where, __m128 x) {
+    __m128 value = _mm_set1_ps(where->value.f);
+    switch (where->op) {
+        case LLIST_WHERE_EQ:
+            return _mm_cmpeq_ps(x, value);
+        case LLIST_WHERE_LT:
+            return _mm_cmplt_ps(x, value);
+        case LLIST_WHERE_GT:
+            return _mm_cmpgt_ps(x, value);
+        case LLIST_WHERE_RANGE:
+            return _mm_and_ps(_mm_cmpge_ps(x, value), _mm_cmple_ps(x, _mm_set1_ps(where->upper.f)));
+        case LLIST_WHERE_IN: {
+            __m128 hit = _mm_setzero_ps();
+            for (size_t k = 0; k < where->nset; k++) {
+                hit = _mm_or_ps(hit, _mm_cmpeq_ps(x, _mm_set1_ps(where->set[k].f)));
+            }
+            return hit;
+        }
+    }
+    return _mm_setzero_ps();
+}
+
+[[gnu::target("sse2")]]
+static uint64_t where_sse2 (const llist__Where * where, const Fields * fields, size_t n) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < n; i += 4) {
+        int bits = 0;
+        if (where->type == LLIST_FIELD_INT) {
+            __m128i hit = where_sse2_int(where, _mm_loadu_si128((const __m128i *) &fields->i[i]));
+            bits = _mm_movemask_ps(_mm_castsi128_ps(hit));
+        } else {
+            bits = _mm_movemask_ps(where_sse2_float(where, _mm_loadu_ps(&fields->f[i])));
+        }
+        mask |= (uint64_t) bits << i;
+    }
+    return mask;
+}
+
+[[gnu::target("avx2")]]
+static __m256i where_avx2_int (const llist__Where * where, __m256i x) {
+    __m256i value = _mm256_set1_epi32(where->value.i);
+    switch (where->op) {
+        case LLIST_WHERE_EQ:
+            return _mm256_cmpeq_epi32(x, value);
+        case LLIST_WHERE_LT:
+            return _mm256_cmpgt_epi32(value, x);
+        case LLIST_WHERE_GT:
+            return _mm256_cmpgt_epi32(x, value);
+        case LLIST_WHERE_RANGE:
+            return _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpgt_epi32(value, x),
+                                                       _mm256_cmpgt_epi32(x, _mm256_set1_epi32(where->upper.i))),
+                                       _mm256_set1_epi32(-1));
+        case LLIST_WHERE_IN: {
+            __m256i hit = _mm256_setzero_si256();
+            for (size_t k = 0; k < where->nset; k++) {
+                hit = _mm256_or_si256(hit, _mm256_cmpeq_epi32(x, _mm256_set1_epi32(where->set[k].i)));
+            }
+            return hit;
+        }
+    }
+    return _mm256_setzero_si256();
+}
+
+[[gnu::target("avx2")]]
+static __m256 where_avx2_float (const llist__Where * where, __m256 x) {
+    __m256 value = _mm256_set1_ps(where->value.f);
+    switch (where->op) {
+        case LLIST_WHERE_EQ:
+            return _mm256_cmp_ps(x, value, _CMP_EQ_OQ);
+        case LLIST_WHERE_LT:
+            return _mm256_cmp_ps(x, value, _CMP_LT_OQ);
+        case LLIST_WHERE_GT:
+            return _mm256_cmp_ps(x, value, _CMP_GT_OQ);
+        case LLIST_WHERE_RANGE:
+            return _mm256_and_ps(_mm256_cmp_ps(x, value, _CMP_GE_OQ),
+                                 _mm256_cmp_ps(x, _mm256_set1_ps(where->upper.f), _CMP_LE_OQ));
+        case LLIST_WHERE_IN: {
+            __m256 hit = _mm256_setzero_ps();
+            for (size_t k = 0; k < where->nset; k++) {
+                hit = _mm256_or_ps(hit, _mm256_cmp_ps(x, _mm256_set1_ps(where->set[k].f), _CMP_EQ_OQ));
+            }
+            return hit;
+        }
+    }
+    return _mm256_setzero_ps();
+}
+
+[[gnu::target("avx2")]]
+static uint64_t where_avx2 (const llist__Where * where, const Fields * fields, size_t n) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < n; i += 8) {
+        int bits = 0;
+        if (where->type == LLIST_FIELD_INT) {
+            __m256i hit = where_avx2_int(where, _mm256_loadu_si256((const __m256i *) &fields->i[i]));
+            bits = _mm256_movemask_ps(_mm256_castsi256_ps(hit));
+        } else {
+            bits = _mm256_movemask_ps(where_avx2_float(where, _mm256_loadu_ps(&fields->f[i])));
+        }
+        mask |= (uint64_t) bits << i;
+    }
+    return mask;
+}
+
+#endif
+
+static WhereKernel where_kernel (void) {
+#if WHERE_X86
+    if (__builtin_cpu_supports("avx2")) return where_avx2;
+    if (__builtin_cpu_supports("sse2")) return where_sse2;
+#endif
+    return where_scalar;
+}
+
+static void sink_flush (Sink * sink) {
+    // hand the buffered bytes to the kernel, retrying on partial writes
+    size_t done = 0;
+    while (sink->ok && done < sink->len) {
+        ssize_t n = write(sink->fd, sink->buf + done, sink->len - done);
+        if (n >= 0) {
+            done += (size_t) n;
+        } else if (errno != EINTR) {
+            sink->ok = false;
+        }
+    }
+    sink->len = 0;
+}
+
+static char * sink_reserve (Sink * sink, size_t n) {
+    if (sink->size - sink->len < n) {
+        sink_flush(sink);
+    }
+    return sink->buf + sink->len;
+}
+
+static void sink_put (Sink * sink, const void * bytes, size_t n) {
+    memcpy(sink_reserve(sink, n), bytes, n);
+    sink->len += n;
+}
+
+static size_t format_digits (char * out, uint64_t value, size_t mindigits) {
+    // decimal digits of value, left-padded with zeros to mindigits
+    char tmp[20];
+    size_t n = 0;
+    do {
+        tmp[n++] = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (n < mindigits) {
+        tmp[n++] = '0';
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = tmp[n - 1 - i];
+    }
+    return n;
+}
+
+static size_t format_int (char * out, int value) {
+    if (value < 0) {
+        out[0] = '-';
+        return 1 + format_digits(out + 1, (uint64_t) -(int64_t) value, 1);
+    }
+    return format_digits(out, (uint64_t) value, 1);
+}
+
+static size_t format_pointer (char * out, const void * p) {
+    static const char hex[] = "0123456789abcdef";
+    uintptr_t value = (uintptr_t) p;
+    char tmp[2 * sizeof(uintptr_t)];
+    size_t n = 0;
+    do {
+        tmp[n++] = hex[value & 0xf];
+        value >>= 4;
+    } while (value > 0);
+    out[0] = '0';
+    out[1] = 'x';
+    for (size_t i = 0; i < n; i++) {
+        out[2 + i] = tmp[n - 1 - i];
+    }
+    return 2 + n;
+}
+
+static size_t format_double (char * out, double value, unsigned int precision) {
+    // fixed notation like "%.*f", rounding half to even; magnitudes of
+    // 1e15 and up don't fit the integer path and use "%.*e" instead
+    if (isnan(value)) {
+        memcpy(out, "nan", 3);
+        return 3;
+    }
+    size_t n = 0;
+    if (signbit(value)) {
+        out[n++] = '-';
+        value = -value;
+    }
+    if (isinf(value)) {
+        memcpy(out + n, "inf", 3);
+        return n + 3;
+    }
+    if (value >= 1e15) {
+        return n + (size_t) snprintf(out + n, WRITE_MAXELEM - n, "%.*e", (int) precision, value);
+    }
+    uint64_t scale = 1;
+    for (unsigned int i = 0; i < precision; i++) {
+        scale *= 10;
+    }
+    uint64_t whole = (uint64_t) value;
+    double scaled = (value - (double) whole) * (double) scale;
+    uint64_t frac = (uint64_t) scaled;
+    double rest = scaled - (double) frac;
+    uint64_t last = precision > 0 ? frac : whole;
+    if (rest > 0.5 || (rest == 0.5 && (last & 1) == 1)) {
+        frac++;
+    }
+    if (frac >= scale) {
+        whole++;
+        frac -= scale;
+    }
+    n += format_digits(out + n, whole, 1);
+    if (precision > 0) {
+        out[n++] = '.';
+        n += format_digits(out + n, frac, precision);
+    }
+    return n;
+}
+
+static void write_item (Sink * sink, const llist__WriteOptions * opts, const void * p) {
+    if (opts->elem != NULL) {
+        size_t avail = sink->size - sink->len;
+        size_t need = opts->elem(sink->buf + sink->len, avail, p);
+        if (need >= avail) {
+            sink_flush(sink);
+            avail = sink->size;
+            need = opts->elem(sink->buf, avail, p);
+        }
+        if (need < avail) {
+            sink->len += need;
+            return;
+        }
+        // the item doesn't fit even an empty buffer, so format it into a
+        // temporary one and write that directly, like codec_put does
+        char * tmp = malloc(need + 1);
+        if (tmp == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for formatting an item.\n");
+            exit(EXIT_FAILURE);
+        }
+        need = opts->elem(tmp, need + 1, p);
+        Sink direct = { .buf = tmp, .size = need, .len = need, .fd = sink->fd, .ok = sink->ok };
+        sink_flush(&direct);
+        sink->ok = direct.ok;
+        free(tmp);
+        return;
+    }
+    if (opts->binary) {
+        switch (opts->format) {
+            case LLIST_FORMAT_INT:
+                sink_put(sink, p, sizeof(int));
+                break;
+            case LLIST_FORMAT_FLOAT:
+                sink_put(sink, p, sizeof(float));
+                break;
+            case LLIST_FORMAT_DOUBLE:
+                sink_put(sink, p, sizeof(double));
+                break;
+            default:
+                sink_put(sink, (const void *) &p, sizeof(void *));
+        }
+        return;
+    }
+    char * out = sink_reserve(sink, WRITE_MAXELEM);
+    switch (opts->format) {
+        case LLIST_FORMAT_INT:
+            sink->len += format_int(out, *((const int *) p));
+            break;
+        case LLIST_FORMAT_FLOAT:
+            sink->len += format_double(out, (double) *((const float *) p), opts->precision);
+            break;
+        case LLIST_FORMAT_DOUBLE:
+            sink->len += format_double(out, *((const double *) p), opts->precision);
+            break;
+        default:
+            sink->len += format_pointer(out, p);
+    }
+}
+
+static size_t snapshot_align (size_t offset) {
+    return (offset + SNAPSHOT_ALIGN - 1) / SNAPSHOT_ALIGN * SNAPSHOT_ALIGN;
+}
+
+static void sink_pad (Sink * sink, size_t n) {
+    static const char zeros[SNAPSHOT_ALIGN] = { 0 };
+    sink_put(sink, zeros, n);
+}
+
+static size_t codec_size (const llist__Codec * codec, const void * p) {
+    return codec == NULL ? 0 : codec->size(p, codec->ctx);
+}
+
+static void codec_put (Sink * sink, const llist__Codec * codec, const void * p, size_t size) {
+    // encode straight into the buffer when the payload fits, otherwise
+    // via a temporary copy
+    if (size <= sink->size) {
+        char * dst = sink_reserve(sink, size);
+        if (codec->encode == NULL) {
+            memcpy(dst, p, size);
+        } else {
+            codec->encode(dst, p, codec->ctx);
+        }
+        sink->len += size;
+        return;
+    }
+    if (codec->encode == NULL) {
+        sink_flush(sink);
+        Sink direct = { .buf = (char *) p, .size = size, .len = size, .fd = sink->fd, .ok = sink->ok };
+        sink_flush(&direct);
+        sink->ok = direct.ok;
+        return;
+    }
+    char * tmp = malloc(size);
+    if (tmp == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for encoding a payload.\n");
+        exit(EXIT_FAILURE);
+    }
+    codec->encode(tmp, p, codec->ctx);
+    sink_flush(sink);
+    Sink direct = { .buf = tmp, .size = size, .len = size, .fd = sink->fd, .ok = sink->ok };
+    sink_flush(&direct);
+    sink->ok = direct.ok;
+    free(tmp);
+}
+
+static size_t segment_start (const LinkedList * lst, const Segments * segments, size_t iseg) {
+    return iseg * lst->nelems / segments->nsegments;
+}
+
+static void segments_free (LinkedList * lst) {
+    if (lst->segments != NULL) {
+        mem_free(&lst->allocator, lst->segments, sizeof(Segments) + sizeof(Node *) * lst->segments->nsegments);
+        lst->segments = NULL;
+    }
+}
+
+static const Segments * segments_get (LinkedList * lst) {
+    // split the chain into segments of roughly equal length, whose
+    // number depends on nelems alone; reuse the last split while the
+    // list hasn't changed
+    if (lst->segments != NULL && lst->segments->generation == lst->generation) {
+        return lst->segments;
+    }
+    segments_free(lst);
+    size_t nsegments = lst->nelems / SEGMENT_MINLEN;
+    nsegments = nsegments < 1 ? 1 : nsegments > SEGMENT_MAXCOUNT ? SEGMENT_MAXCOUNT : nsegments;
+    Segments * segments = mem_alloc(&lst->allocator, sizeof(Segments) + sizeof(Node *) * nsegments);
+    if (segments == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list segments.\n");
+        exit(EXIT_FAILURE);
+    }
+    segments->generation = lst->generation;
+    segments->nsegments = nsegments;
+    Node * curr = lst->firstnode;
+    size_t pos = 0;
+    for (size_t i = 0; i < nsegments; i++) {
+        for (size_t start = segment_start(lst, segments, i); pos < start; pos++) {
+            curr = curr->next;
+        }
+        segments->starts[i] = curr;
+    }
+    lst->segments = segments;
+    return segments;
+}
+
+static int job_worker (void * arg) {
+    Job * job = arg;
+    const LinkedList * lst = job->lst;
+    const Segments * segments = job->segments;
+    for (;;) {
+        size_t iseg = atomic_fetch_add(&job->next, 1);
+        if (iseg >= segments->nsegments) break;
+        size_t pos = segment_start(lst, segments, iseg);
+        size_t len = segment_start(lst, segments, iseg + 1) - pos;
+        job->run(job, iseg, segments->starts[iseg], pos, len);
+    }
+    return 0;
+}
+
+static void job_execute (Job * job, size_t nthreads) {
+    // the calling thread works too; threads that fail to start simply
+    // leave more segments for the others
+    if (nthreads == 0) {
+        long nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = nprocs < 1 ? 1 : (size_t) nprocs;
+    }
+    if (nthreads > job->segments->nsegments) {
+        nthreads = job->segments->nsegments;
+    }
+    thrd_t * threads = nthreads > 1 ? malloc(sizeof(thrd_t) * (nthreads - 1)) : NULL;
+    size_t nstarted = 0;
+    if (threads != NULL) {
+        while (nstarted < nthreads - 1 && thrd_create(&threads[nstarted], job_worker, job) == thrd_success) {
+            nstarted++;
+        }
+    }
+    job_worker(job);
+    for (size_t i = 0; i < nstarted; i++) {
+        thrd_join(threads[i], NULL);
+    }
+    free(threads);
+}
+
+static void run_for_each (Job * job, size_t, Node * first, size_t, size_t len) {
+    Node * curr = first;
+    for (size_t i = 0; i < len; i++, curr = curr->next) {
+        job->fn(curr->payload, job->ctx);
+    }
+}
+
+static void run_filter (Job * job, size_t, Node * first, size_t pos, size_t len) {
+    Node * curr = first;
+    for (size_t i = 0; i < len; i++, curr = curr->next) {
+        job->flags[pos + i] = job->pred(curr->payload, job->ctx);
+    }
+}
+
+static void run_reduce (Job * job, size_t iseg, Node * first, size_t, size_t len) {
+    void * acc = job->partials + iseg * job->reducer->size;
+    Node * curr = first;
+    for (size_t i = 0; i < len; i++, curr = curr->next) {
+        job->reducer->step(acc, curr->payload, job->reducer->ctx);
+    }
+}
+
+void llist__append (LinkedList * lst, void * item) {
+    llist__insert(lst->nelems, item, lst);
+}
+
+void llist__append_array (LinkedList * lst, void ** items, const size_t n) {
+    if (n == 0) return;
+    // build the chain off to the side, then attach it in one go
+    Node * first = node_alloc(lst);
+    first->payload = items[0];
+    first->prev = lst->lastnode;
+    Node * last = first;
+    for (size_t i = 1; i < n; i++) {
+        Node * new = node_alloc(lst);
+        new->payload = items[i];
+        new->prev = last;
+        last->next = new;
+        last = new;
+    }
+    last->next = NULL;
+    if (lst->lastnode == NULL) {
+        lst->firstnode = first;
+    } else {
+        lst->lastnode->next = first;
+    }
+    lst->lastnode = last;
+    lst->nelems += n;
+    index_invalidate(lst);
+    if (keys_live(lst)) {
+        for (Node * curr = first; curr != NULL; curr = curr->next) {
+            keys_put(lst->keys, curr);
+        }
+    }
+}
+
+llist__Locality llist__compact (LinkedList * lst) {
+    size_t nnear = locality_count(lst);
+    llist__Locality locality = { .before = locality_ratio(lst, nnear), .after = 1.0 };
+    if (lst->nelems < 2 || nnear == lst->nelems - 1) return locality;
+    // a block of its own keeps the nodes adjacent whatever the list draws
+    // its other nodes from
+    Block * block = NULL;
+    if (blocks_try_reserve(lst)) {
+        block = mem_alloc(&lst->allocator, sizeof(Block) + sizeof(Node) * lst->nelems);
+    }
+    if (block == NULL) {
+        // compacting is only an optimization, and lst is still intact
+        errno = ENOMEM;
+        locality.after = locality.before;
+        return locality;
+    }
+    spares_release(lst);
+    block->nnodes = lst->nelems;
+    block->nlive = lst->nelems;
+    block->nrefs = 0;
+    block->freelist = NULL;
+    size_t i = 0;
+    for (Node * old = lst->firstnode; old != NULL; old = old->next) {
+        block->nodes[i].payload = old->payload;
+        block->nodes[i].next = old->next == NULL ? NULL : &block->nodes[i + 1];
+        STATS_ALLOC(lst);
+        i++;
+    }
+    // the old nodes go straight back to where they came from rather than
+    // onto the spares, where later insertions would pick them up again;
+    // this frees the blocks of earlier compactions as they empty
+    blocks_add(lst, block);
+    Node * old = lst->firstnode;
+    while (old != NULL) {
+        Node * next = old->next;
+        node_release(lst, old);
+        old = next;
+    }
+    STATS_FREE(lst, lst->nelems);
+    // none of the nodes of lst are in any other block anymore
+    for (size_t j = lst->nblocks; j-- > 0;) {
+        if (lst->blocks[j] != block) {
+            blocks_drop(lst, j);
+        }
+    }
+    lst->home = block;
+    chain_adopt(lst, &block->nodes[0], lst->nelems);
+    keys_invalidate(lst);
+    locality.after = locality_ratio(lst, locality_count(lst));
+    return locality;
+}
+
+bool llist__contains (LinkedList * lst, const void * key) {
+    STATS_BEGIN();
+    bool found = keys_find(lst, key) != NULL;
+    STATS_END(lst, LLIST_STATS_FIND);
+    return found;
 }
 
 LinkedList * llist__create (void) {
-    LinkedList * lst = malloc(sizeof(LinkedList) * 1);
-    if (lst == NULL) {
-        fprintf(stderr, "Something went wrong allocating memory for linked list.\n");
-        exit(EXIT_FAILURE);
-    }
-    lst->nelems = 0;
-    lst->firstnode = NULL;
+    return list_create(NULL);
+}
+
+LinkedList * llist__create_with_pool (llist__NodePool * pool) {
+    LinkedList * lst = llist__create();
+    lst->pool = pool;
+    pool->nlists++;
     return lst;
 }
 
 void llist__delete (const bool global, LinkedList * lst, bool (*filter)(void *)) {
-    Node * prev = NULL;
+    STATS_BEGIN();
+    size_t pos = 0;
+    size_t nunlinked = 0;
+    Walk walk = walk_begin(lst, true);
     Node * curr = lst->firstnode;
     while (curr != NULL) {
-        bool cond = filter(curr->payload);
-        if (cond && prev == NULL) {
-            // item is first item
-            lst->firstnode = curr->next;
-            Node * tmp = curr;
-            prev = NULL;
-            curr = curr->next;
-            lst->nelems--;
-            free(tmp);
-        } else if (cond) {
-            // item is not first
-            Node * tmp = curr;
-            prev->next = curr->next;
-            curr = curr->next;
-            lst->nelems--;
-            free(tmp);
+        Node * next = curr->next;
+        walk_step(&walk);
+        STATS_NODES(1);
+        if (filter(curr->payload)) {
+            if (!global && index_live(lst)) {
+                // a single deletion keeps the index up to date
+                index_remove(lst, pos);
+            } else {
+                node_unlink(lst, curr);
+                nunlinked++;
+            }
+            node_free(lst, curr);
+            if (!global) break;
+        } else {
+            walk_keep(&walk, curr);
+            pos++;
+        }
+        curr = next;
+    }
+    if (nunlinked > 0) {
+        index_invalidate(lst);
+    }
+    walk_end(lst, &walk, curr == NULL);
+    STATS_END(lst, LLIST_STATS_DELETE);
+}
+
+size_t llist__delete_ctx (LinkedList * lst, bool (*pred)(void *, void *), void * ctx, const size_t limit,
+                          LinkedList * removed) {
+    assert(removed != lst && "Can't move deleted elements into the same linked list\n");
+    STATS_BEGIN();
+    if (removed != NULL) {
+        list_check_source(removed, lst);
+        blocks_share(removed, lst);
+    }
+    size_t ndeleted = 0;
+    Walk walk = walk_begin(lst, true);
+    Node * curr = lst->firstnode;
+    while (curr != NULL && ndeleted < limit) {
+        Node * next = curr->next;
+        walk_step(&walk);
+        STATS_NODES(1);
+        if (pred(curr->payload, ctx)) {
+            node_unlink(lst, curr);
+            if (removed == NULL) {
+                node_free(lst, curr);
+            } else {
+                node_link(removed, removed->lastnode, curr, NULL);
+            }
+            ndeleted++;
         } else {
-            prev = curr;
+            walk_keep(&walk, curr);
+        }
+        curr = next;
+    }
+    if (ndeleted > 0) {
+        index_invalidate(lst);
+        if (removed != NULL) {
+            index_invalidate(removed);
+        }
+    }
+    walk_end(lst, &walk, curr == NULL);
+    STATS_END(lst, LLIST_STATS_DELETE);
+    return ndeleted;
+}
+
+void * llist__delete_key (LinkedList * lst, const void * key) {
+    STATS_BEGIN();
+    Node * node = keys_find(lst, key);
+    void * payload = NULL;
+    if (node != NULL) {
+        // the position of node is unknown, so the index can't follow along
+        index_invalidate(lst);
+        payload = node->payload;
+        node_unlink(lst, node);
+        node_free(lst, node);
+    }
+    STATS_END(lst, LLIST_STATS_DELETE);
+    return payload;
+}
+
+size_t llist__delete_where (LinkedList * lst, const llist__Where * where) {
+    STATS_BEGIN();
+    WhereKernel kernel = where_kernel();
+    const size_t offset = where->offset;
+    Fields fields = { .i = { 0 } };
+    Node * batch[WHERE_BATCH];
+    size_t ndeleted = 0;
+    Walk walk = walk_begin(lst, true);
+    Node * curr = lst->firstnode;
+    while (curr != NULL) {
+        // collect the nodes first, such that the loads of their fields
+        // don't depend on each other and can all be in flight at once
+        size_t n = 0;
+        for (; n < WHERE_BATCH && curr != NULL; n++) {
+            walk_step(&walk);
+            batch[n] = curr;
             curr = curr->next;
         }
-        if (cond && !global) return;
+        for (size_t i = 0; i < n; i++) {
+            memcpy(&fields.i[i], (const char *) batch[i]->payload + offset, sizeof(fields.i[i]));
+        }
+        STATS_NODES(n);
+        uint64_t mask = kernel(where, &fields, n);
+        if (n < WHERE_BATCH) {
+            mask &= ((uint64_t) 1 << n) - 1;
+        }
+        if (walk.la == NULL) {
+            // only the matches need visiting
+            for (; mask != 0; mask &= mask - 1) {
+                Node * node = batch[where_lowest_bit(mask)];
+                node_unlink(lst, node);
+                node_free(lst, node);
+                ndeleted++;
+            }
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if ((mask >> i) & 1) {
+                node_unlink(lst, batch[i]);
+                node_free(lst, batch[i]);
+                ndeleted++;
+            } else {
+                walk_keep(&walk, batch[i]);
+            }
+        }
     }
+    if (ndeleted > 0) {
+        index_invalidate(lst);
+    }
+    walk_end(lst, &walk, true);
+    STATS_END(lst, LLIST_STATS_DELETE);
+    return ndeleted;
 }
 
 void llist__destroy (LinkedList ** lst) {
-    Node * curr = (*lst)->firstnode;
-    while (curr != NULL) {
-        struct node * tmp = curr;
-        curr = curr->next;
-        free(tmp);
-        (*lst)->nelems--;
+    llist__set_indexed(*lst, false);
+    llist__set_keyed(*lst, NULL);
+    llist__shrink_to_fit(*lst);
+    if ((*lst)->pool == NULL || (*lst)->nblocks > 0) {
+        Walk walk = walk_begin(*lst, false);
+        Node * curr = (*lst)->firstnode;
+        while (curr != NULL) {
+            struct node * tmp = curr;
+            curr = curr->next;
+            walk_step(&walk);
+            node_free(*lst, tmp);
+            (*lst)->nelems--;
+        }
+    } else {
+        // hand the whole chain back to the pool in one go
+        if ((*lst)->lastnode != NULL) {
+            (*lst)->lastnode->next = (*lst)->pool->freelist;
+            (*lst)->pool->freelist = (*lst)->firstnode;
+        }
+        STATS_FREE(*lst, (*lst)->nelems);
+        (*lst)->nelems = 0;
+    }
+    while ((*lst)->nblocks > 0) {
+        blocks_drop(*lst, (*lst)->nblocks - 1);
+    }
+    if ((*lst)->blocks != NULL) {
+        // room was made for a block that couldn't be allocated
+        mem_free(&(*lst)->allocator, (*lst)->blocks, sizeof(Block *) * (*lst)->capblocks);
+    }
+    if ((*lst)->pool != NULL) {
+        llist__NodePool * pool = (*lst)->pool;
+        pool->nlists--;
+        if (pool->mapping != NULL && pool->nlists == 0) {
+            // loaded snapshots own their pool, see llist__load_mmap
+            llist__pool_destroy(&pool);
+        }
     }
     assert((*lst)->nelems == 0 && "Expected number of elements in linked list to be 0 after clearing all items.\n");
-    free(*lst);
+    llist__set_prefetch(*lst, 0, false);
+    segments_free(*lst);
+    mem_free(&(*lst)->allocator, *lst, sizeof(LinkedList));
     *lst = NULL;
 }
 
+void llist__extend (LinkedList * dst, LinkedList * src) {
+    llist__splice(dst, dst->nelems, src);
+}
+
+void * llist__find (LinkedList * lst, const void * key) {
+    STATS_BEGIN();
+    Node * node = keys_find(lst, key);
+    STATS_END(lst, LLIST_STATS_FIND);
+    return node == NULL ? NULL : node->payload;
+}
+
+size_t llist__insert_sorted (LinkedList * lst, void * item, int (*cmp)(const void *, const void *, void *),
+                             void * ctx) {
+    // appending is the common case when items arrive (nearly) in order
+    STATS_BEGIN();
+    size_t pos = lst->nelems;
+    Node * next = NULL;
+    if (lst->lastnode != NULL && cmp(lst->lastnode->payload, item, ctx) > 0) {
+        pos = 0;
+        next = lst->firstnode;
+        while (cmp(next->payload, item, ctx) <= 0) {
+            next = next->next;
+            pos++;
+        }
+        STATS_NODES(pos + 1);
+    }
+    if (lst->index != NULL) {
+        node_insert(lst, pos, node_alloc(lst), item);
+    } else {
+        Node * new = node_alloc(lst);
+        new->payload = item;
+        node_link(lst, next == NULL ? lst->lastnode : next->prev, new, next);
+    }
+    STATS_END(lst, LLIST_STATS_INSERT);
+    return pos;
+}
+
 void llist__insert (const size_t pos, void * item, LinkedList * lst) {
-    Node * new = malloc(sizeof(Node) * 1);
-    if (new == NULL) {
-        fprintf(stderr, "Something went wrong allocating memory for new node in linked list.\n");
-        exit(EXIT_FAILURE);
+    assert(pos <= lst->nelems && "Can't insert element past the end of the list\n");
+    STATS_BEGIN();
+    node_insert(lst, pos, node_alloc(lst), item);
+    STATS_END(lst, LLIST_STATS_INSERT);
+}
+
+void * llist__get (const size_t pos, LinkedList * lst) {
+    assert(pos < lst->nelems && "Can't get element past the end of the list\n");
+    STATS_BEGIN();
+    Node * node = NULL;
+    if (lst->index == NULL) {
+        node = node_at(lst, pos);
+    } else {
+        index_refresh(lst);
+        Lane * update[INDEX_MAXLEVEL] = { NULL };
+        size_t ranks[INDEX_MAXLEVEL] = { 0 };
+        index_find(lst->index, pos + 2, update, ranks);
+        node = index_walk(lst, update[0], ranks[0], pos + 1);
     }
+    STATS_END(lst, LLIST_STATS_GET);
+    return node->payload;
+}
+
+size_t llist__get_length (const LinkedList * lst) {
+    return lst->nelems;
+}
+
+llist__Iter llist__iter_begin (LinkedList * lst) {
+    return (llist__Iter) { .lst = lst, .curr = NULL, .done = false };
+}
+
+void * llist__iter_get (const llist__Iter * it) {
+    assert(it->curr != NULL && "Expected the cursor to be positioned on an item\n");
+    return it->curr->payload;
+}
+
+void llist__iter_insert_after (llist__Iter * it, void * item) {
+    assert(!it->done && "Can't insert element after the end of the list\n");
+    index_invalidate(it->lst);
+    Node * new = node_alloc(it->lst);
     new->payload = item;
-    new->next = NULL;
+    Node * next = it->curr == NULL ? it->lst->firstnode : it->curr->next;
+    node_link(it->lst, it->curr, new, next);
+    it->curr = new;
+}
 
-    assert(pos <= lst->nelems && "Can't insert element past the end of the list\n");
+bool llist__iter_next (llist__Iter * it) {
+    if (it->done) return false;
+    it->curr = it->curr == NULL ? it->lst->firstnode : it->curr->next;
+    it->done = it->curr == NULL;
+    return !it->done;
+}
 
-    Node * prev = NULL;
-    Node * curr = lst->firstnode;
-    for (size_t i = 0; i < pos && curr != NULL; i++) {
-        prev = curr;
+void * llist__iter_remove_here (llist__Iter * it) {
+    assert(it->curr != NULL && "Expected the cursor to be positioned on an item\n");
+    index_invalidate(it->lst);
+    Node * node = it->curr;
+    void * payload = node->payload;
+    it->curr = node->prev;
+    node_unlink(it->lst, node);
+    node_free(it->lst, node);
+    return payload;
+}
+
+size_t llist__partition (LinkedList * lst, bool (*pred)(void *, void *), void * ctx, LinkedList * dst) {
+    assert(dst != NULL && "Expected a linked list to move the matching elements into\n");
+    return llist__delete_ctx(lst, pred, ctx, SIZE_MAX, dst);
+}
+
+llist__NodePool * llist__pool_create (const size_t nodes_per_slab) {
+    assert(nodes_per_slab > 0 && "Expected slabs to hold at least one node\n");
+    llist__NodePool * pool = malloc(sizeof(llist__NodePool) * 1);
+    if (pool == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for node pool.\n");
+        exit(EXIT_FAILURE);
+    }
+    pool->nlists = 0;
+    pool->nodes_per_slab = nodes_per_slab;
+    pool->slabs = NULL;
+    pool->freelist = NULL;
+    pool->bump = NULL;
+    pool->bumpend = NULL;
+    pool->mapping = NULL;
+    pool->mapsize = 0;
+    return pool;
+}
+
+void llist__pool_destroy (llist__NodePool ** pool) {
+    assert((*pool)->nlists == 0 && "Expected all linked lists using the pool to be destroyed first.\n");
+    Slab * curr = (*pool)->slabs;
+    while (curr != NULL) {
+        Slab * tmp = curr;
         curr = curr->next;
+        free(tmp);
+    }
+    if ((*pool)->mapping != NULL) {
+        munmap((*pool)->mapping, (*pool)->mapsize);
+    }
+    free(*pool);
+    *pool = NULL;
+}
+
+LinkedList * llist__load_mmap (const char * path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return NULL;
+    }
+    size_t mapsize = (size_t) st.st_size;
+    if (mapsize < sizeof(SnapshotHeader)) {
+        close(fd);
+        errno = EINVAL;
+        return NULL;
+    }
+    // a private writable mapping: relocating the node records only
+    // copies the pages they occupy, and never touches the file
+    char * base = mmap(NULL, mapsize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+
+    SnapshotHeader header;
+    memcpy(&header, base, sizeof(header));
+    uint64_t nodes_end = header.nodes_offset + header.nelems * sizeof(SnapshotNode);
+    bool valid = memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 &&
+                 header.byteorder == 0x01020304 && header.ptrsize == sizeof(void *) &&
+                 sizeof(SnapshotNode) == sizeof(Node) && header.nodes_offset >= sizeof(SnapshotHeader) &&
+                 header.nodes_offset <= mapsize && header.payloads_offset <= mapsize &&
+                 header.nodes_offset % SNAPSHOT_ALIGN == 0 && header.nelems <= mapsize / sizeof(SnapshotNode) &&
+                 nodes_end <= mapsize && header.payloads_offset >= nodes_end &&
+                 header.payloads_size <= mapsize - header.payloads_offset;
+    if (!valid) {
+        munmap(base, mapsize);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    // turn the records into nodes in place: offsets become pointers.
+    // Where supported, take the copy-on-write faults for the records in
+    // one go; the payloads stay shared with the page cache
+    Node * nodes = (Node *) (base + header.nodes_offset);
+#ifdef MADV_POPULATE_WRITE
+    uintptr_t pagemask = (uintptr_t) sysconf(_SC_PAGESIZE) - 1;
+    char * first = (char *) ((uintptr_t) nodes & ~pagemask);
+    madvise(first, (size_t) (base + nodes_end - first), MADV_POPULATE_WRITE);
+#endif
+    bool raw = (header.flags & SNAPSHOT_RAW_PAYLOADS) != 0;
+    for (uint64_t i = 0; i < header.nelems; i++) {
+        SnapshotNode record;
+        memcpy(&record, &nodes[i], sizeof(record));
+        bool linked = record.next == (i + 1 < header.nelems ? header.nodes_offset + (i + 1) * sizeof(Node) : 0) &&
+                      record.prev == (i > 0 ? header.nodes_offset + (i - 1) * sizeof(Node) : 0);
+        if (!linked || (!raw && (record.payload < header.payloads_offset || record.payload > mapsize))) {
+            munmap(base, mapsize);
+            errno = EINVAL;
+            return NULL;
+        }
+        nodes[i].payload = raw ? (void *) (uintptr_t) record.payload : base + record.payload;
+        nodes[i].next = i + 1 < header.nelems ? &nodes[i + 1] : NULL;
+        nodes[i].prev = i > 0 ? &nodes[i - 1] : NULL;
+    }
+
+    llist__NodePool * pool = llist__pool_create(4096);
+    pool->mapping = base;
+    pool->mapsize = mapsize;
+    LinkedList * lst = llist__create_with_pool(pool);
+    if (header.nelems > 0) {
+        lst->firstnode = &nodes[0];
+        lst->lastnode = &nodes[header.nelems - 1];
+        lst->nelems = header.nelems;
+    }
+    return lst;
+}
+
+double llist__locality (const LinkedList * lst) {
+    return locality_ratio(lst, locality_count(lst));
+}
+
+void llist__merge (LinkedList * dst, LinkedList ** srcs, const size_t k, int (*cmp)(const void *, const void *, void *),
+                  void * ctx) {
+    // merge adjacent pairs of lists in rounds, such that every item takes
+    // part in O(log k) merges; list 0 is dst, list i is srcs[i - 1]
+    size_t nelems = dst->nelems;
+    for (size_t i = 0; i < k; i++) {
+        assert(srcs[i] != dst && "Can't merge a linked list into itself\n");
+        list_check_source(srcs[i], dst);
+        blocks_share(dst, srcs[i]);
+        nelems += srcs[i]->nelems;
+    }
+    for (size_t step = 1; step <= k; step *= 2) {
+        for (size_t i = 0; i + step <= k; i += 2 * step) {
+            LinkedList * left = i == 0 ? dst : srcs[i - 1];
+            LinkedList * right = srcs[i + step - 1];
+            left->firstnode = chain_merge(left->firstnode, right->firstnode, cmp, ctx);
+            left->nelems += right->nelems;
+            right->firstnode = NULL;
+            right->lastnode = NULL;
+            right->nelems = 0;
+            index_invalidate(right);
+            keys_invalidate(right);
+        }
+    }
+    chain_adopt(dst, dst->firstnode, nelems);
+    keys_invalidate(dst);
+}
+
+void * llist__move_to_front (LinkedList * lst, const void * key) {
+    STATS_BEGIN();
+    Node * node = keys_find(lst, key);
+    if (node != NULL && node != lst->firstnode) {
+        // relink in place, the node stays in the keyed index
+        index_invalidate(lst);
+        node->prev->next = node->next;
+        if (node->next == NULL) {
+            lst->lastnode = node->prev;
+        } else {
+            node->next->prev = node->prev;
+        }
+        node->prev = NULL;
+        node->next = lst->firstnode;
+        lst->firstnode->prev = node;
+        lst->firstnode = node;
+    }
+    STATS_END(lst, LLIST_STATS_FIND);
+    return node == NULL ? NULL : node->payload;
+}
+
+size_t llist__parallel_filter (LinkedList * lst, bool (*pred)(void *, void *), void * ctx, size_t nthreads) {
+    if (lst->nelems == 0) return 0;
+    unsigned char * flags = malloc(lst->nelems);
+    if (flags == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for filter results.\n");
+        exit(EXIT_FAILURE);
+    }
+    Job job = { .lst = lst, .segments = segments_get(lst), .run = run_filter, .pred = pred, .ctx = ctx, .flags = flags };
+    atomic_init(&job.next, 0);
+    job_execute(&job, nthreads);
+
+    size_t ndeleted = 0;
+    Node * curr = lst->firstnode;
+    for (size_t pos = 0; curr != NULL; pos++) {
+        Node * next = curr->next;
+        if (flags[pos]) {
+            node_unlink(lst, curr);
+            node_free(lst, curr);
+            ndeleted++;
+        }
+        curr = next;
+    }
+    if (ndeleted > 0) {
+        index_invalidate(lst);
     }
-    new->next = curr;
-    if (pos == 0) {
-        lst->firstnode = new;
+    free(flags);
+    return ndeleted;
+}
+
+void llist__parallel_for_each (LinkedList * lst, void (*fn)(void *, void *), void * ctx, size_t nthreads) {
+    if (lst->nelems == 0) return;
+    Job job = { .lst = lst, .segments = segments_get(lst), .run = run_for_each, .fn = fn, .ctx = ctx };
+    atomic_init(&job.next, 0);
+    job_execute(&job, nthreads);
+}
+
+void * llist__pop_back (LinkedList * lst) {
+    assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");
+    STATS_BEGIN();
+    Node * node = NULL;
+    if (index_live(lst)) {
+        node = index_remove(lst, lst->nelems - 1);
     } else {
-        prev->next = new;
+        node = lst->lastnode;
+        node_unlink(lst, node);
     }
-    lst->nelems++;
+    void * payload = node->payload;
+    node_free(lst, node);
+    STATS_END(lst, LLIST_STATS_REMOVE);
+    return payload;
 }
 
-size_t llist__get_length (const LinkedList * lst) {
-    return lst->nelems;
+void * llist__pop_front (LinkedList * lst) {
+    assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");
+    STATS_BEGIN();
+    Node * node = NULL;
+    if (index_live(lst)) {
+        node = index_remove(lst, 0);
+    } else {
+        node = lst->firstnode;
+        node_unlink(lst, node);
+    }
+    void * payload = node->payload;
+    node_free(lst, node);
+    STATS_END(lst, LLIST_STATS_REMOVE);
+    return payload;
 }
 
 void llist__prepend (LinkedList * lst, void * item) {
@@ -116,9 +2307,12 @@ void llist__print (const LinkedList * lst, const llist__Printers * printers, FIL
     }
 
     // -- print each elem
+    Walk walk = walk_begin(lst, true);
     Node * curr = lst->firstnode;
     size_t i = 0;
     while (curr != NULL) {
+        walk_step(&walk);
+        walk_keep(&walk, curr);
         if (printers == NULL || printers->elem == NULL) {
             fprintf(fd, "%p%s", curr->payload, curr->next == NULL ? "" : ", ");
         } else {
@@ -127,6 +2321,7 @@ void llist__print (const LinkedList * lst, const llist__Printers * printers, FIL
         curr = curr->next;
         i++;
     }
+    walk_end(lst, &walk, true);
 
     // -- print postamble
     if (printers == NULL || printers->post == NULL) {
@@ -135,3 +2330,430 @@ void llist__print (const LinkedList * lst, const llist__Printers * printers, FIL
         printers->post(fd, lst->nelems);
     }
 }
+
+void llist__reduce (LinkedList * lst, const llist__Reducer * reducer, void * acc, size_t nthreads) {
+    if (lst->nelems == 0) return;
+    const Segments * segments = segments_get(lst);
+    char * partials = malloc(reducer->size * segments->nsegments);
+    if (partials == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for partial results.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < segments->nsegments; i++) {
+        memcpy(partials + i * reducer->size, acc, reducer->size);
+    }
+    Job job = { .lst = lst, .segments = segments, .run = run_reduce, .reducer = reducer, .partials = partials };
+    atomic_init(&job.next, 0);
+    job_execute(&job, nthreads);
+    for (size_t i = 0; i < segments->nsegments; i++) {
+        reducer->combine(acc, partials + i * reducer->size, reducer->ctx);
+    }
+    free(partials);
+}
+
+void * llist__remove (const size_t pos, LinkedList * lst) {
+    assert(pos < lst->nelems && "Can't remove element past the end of the list\n");
+    STATS_BEGIN();
+    Node * node = NULL;
+    if (lst->index == NULL) {
+        node = node_at(lst, pos);
+        node_unlink(lst, node);
+    } else {
+        index_refresh(lst);
+        node = index_remove(lst, pos);
+    }
+    void * payload = node->payload;
+    node_free(lst, node);
+    STATS_END(lst, LLIST_STATS_REMOVE);
+    return payload;
+}
+
+void llist__reserve (LinkedList * lst, const size_t n) {
+    while (lst->nelems + lst->nspares < n) {
+        Node * node = node_acquire(lst);
+        if (node == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for spare node in linked list.\n");
+            exit(EXIT_FAILURE);
+        }
+        node->next = lst->spares;
+        lst->spares = node;
+        lst->nspares++;
+    }
+    if (lst->maxspares < n) {
+        lst->maxspares = n;
+    }
+}
+
+bool llist__save (const LinkedList * lst, int fd, const llist__Codec * codec) {
+    Sink sink = { .buf = malloc(WRITE_BUFSIZE), .size = WRITE_BUFSIZE, .len = 0, .fd = fd, .ok = true };
+    if (sink.buf == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the write buffer.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // the records are written in list order, so neighbors sit next to
+    // each other; the payloads follow, each aligned to SNAPSHOT_ALIGN
+    SnapshotHeader header = {
+        .byteorder = 0x01020304,
+        .ptrsize = sizeof(void *),
+        .flags = codec == NULL ? SNAPSHOT_RAW_PAYLOADS : 0,
+        .nelems = lst->nelems,
+        .nodes_offset = snapshot_align(sizeof(SnapshotHeader)),
+    };
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.payloads_offset = snapshot_align(header.nodes_offset + lst->nelems * sizeof(SnapshotNode));
+    for (Node * curr = lst->firstnode; curr != NULL; curr = curr->next) {
+        header.payloads_size = snapshot_align(header.payloads_size + codec_size(codec, curr->payload));
+    }
+    sink_put(&sink, &header, sizeof(header));
+    sink_pad(&sink, header.nodes_offset - sizeof(header));
+
+    uint64_t offset = header.payloads_offset;
+    uint64_t i = 0;
+    for (Node * curr = lst->firstnode; curr != NULL; curr = curr->next, i++) {
+        SnapshotNode record = {
+            .payload = codec == NULL ? (uint64_t) (uintptr_t) curr->payload : offset,
+            .next = curr->next == NULL ? 0 : header.nodes_offset + (i + 1) * sizeof(SnapshotNode),
+            .prev = curr->prev == NULL ? 0 : header.nodes_offset + (i - 1) * sizeof(SnapshotNode),
+        };
+        sink_put(&sink, &record, sizeof(record));
+        offset = snapshot_align(offset + codec_size(codec, curr->payload));
+    }
+    sink_pad(&sink, header.payloads_offset - (header.nodes_offset + lst->nelems * sizeof(SnapshotNode)));
+
+    if (codec != NULL) {
+        for (Node * curr = lst->firstnode; curr != NULL && sink.ok; curr = curr->next) {
+            size_t size = codec_size(codec, curr->payload);
+            codec_put(&sink, codec, curr->payload, size);
+            sink_pad(&sink, snapshot_align(size) - size);
+        }
+    }
+    sink_flush(&sink);
+    free(sink.buf);
+    return sink.ok;
+}
+
+void llist__sort (LinkedList * lst, int (*cmp)(const void *, const void *, void *), void * ctx) {
+    // bottom-up merge sort: bins[i] holds a sorted chain of 2^i nodes, and
+    // every incoming node is carried upwards through the bins like a binary
+    // counter. Earlier nodes always end up on the left-hand side of a merge,
+    // which keeps the sort stable.
+    Node * bins[64] = { NULL };
+    size_t nbins = 0;
+    Node * curr = lst->firstnode;
+    while (curr != NULL) {
+        Node * next = curr->next;
+        curr->next = NULL;
+        Node * carry = curr;
+        size_t i = 0;
+        while (bins[i] != NULL) {
+            carry = chain_merge(bins[i], carry, cmp, ctx);
+            bins[i] = NULL;
+            i++;
+        }
+        bins[i] = carry;
+        if (i + 1 > nbins) {
+            nbins = i + 1;
+        }
+        curr = next;
+    }
+    Node * sorted = NULL;
+    for (size_t i = 0; i < nbins; i++) {
+        if (bins[i] != NULL) {
+            sorted = sorted == NULL ? bins[i] : chain_merge(bins[i], sorted, cmp, ctx);
+        }
+    }
+    chain_adopt(lst, sorted, lst->nelems);
+}
+
+void llist__splice (LinkedList * dst, const size_t pos, LinkedList * src) {
+    assert(pos <= dst->nelems && "Can't splice elements past the end of the list\n");
+    assert(dst != src && "Can't splice a linked list into itself\n");
+    list_check_source(dst, src);
+    if (src->nelems == 0) return;
+    blocks_share(dst, src);
+    Node * next = pos == dst->nelems ? NULL : node_at(dst, pos);
+    Node * prev = next == NULL ? dst->lastnode : next->prev;
+    src->firstnode->prev = prev;
+    src->lastnode->next = next;
+    if (prev == NULL) {
+        dst->firstnode = src->firstnode;
+    } else {
+        prev->next = src->firstnode;
+    }
+    if (next == NULL) {
+        dst->lastnode = src->lastnode;
+    } else {
+        next->prev = src->lastnode;
+    }
+    dst->nelems += src->nelems;
+    src->nelems = 0;
+    src->firstnode = NULL;
+    src->lastnode = NULL;
+    index_invalidate(dst);
+    index_invalidate(src);
+    keys_invalidate(dst);
+    keys_invalidate(src);
+}
+
+LinkedList * llist__split (LinkedList * lst, const size_t pos) {
+    assert(pos <= lst->nelems && "Can't split the list past its end\n");
+    LinkedList * tail = lst->pool == NULL ? list_create(&lst->allocator) : llist__create_with_pool(lst->pool);
+    if (pos == lst->nelems) return tail;
+    blocks_share(tail, lst);
+    Node * first = node_at(lst, pos);
+    tail->firstnode = first;
+    tail->lastnode = lst->lastnode;
+    tail->nelems = lst->nelems - pos;
+    lst->lastnode = first->prev;
+    if (first->prev == NULL) {
+        lst->firstnode = NULL;
+    } else {
+        first->prev->next = NULL;
+    }
+    first->prev = NULL;
+    lst->nelems = pos;
+    index_invalidate(lst);
+    keys_invalidate(lst);
+    return tail;
+}
+
+bool llist__stats (const LinkedList * lst, llist__Stats * stats) {
+    *stats = (llist__Stats) { .nallocs = 0 };
+#ifdef LLIST_STATS
+    if (lst != NULL) {
+        *stats = lst->stats;
+        return true;
+    }
+    for (size_t op = 0; op < LLIST_STATS_NOPS; op++) {
+        stats->ops[op].count = atomic_load_explicit(&stats_global.ops[op].count, memory_order_relaxed);
+        stats->ops[op].nodes = atomic_load_explicit(&stats_global.ops[op].nodes, memory_order_relaxed);
+        for (size_t b = 0; b < LLIST_STATS_NBUCKETS; b++) {
+            stats->ops[op].latency[b] = atomic_load_explicit(&stats_global.ops[op].latency[b], memory_order_relaxed);
+        }
+    }
+    stats->nallocs = atomic_load_explicit(&stats_global.nallocs, memory_order_relaxed);
+    stats->nfrees = atomic_load_explicit(&stats_global.nfrees, memory_order_relaxed);
+    return true;
+#else
+    (void) lst;
+    return false;
+#endif
+}
+
+void llist__stats_dump (const llist__Stats * stats, FILE * fd) {
+    static const char * names[LLIST_STATS_NOPS] = { "insert", "get", "remove", "delete", "find" };
+    fprintf(fd, "{\"nallocs\": %llu, \"nfrees\": %llu, \"ops\": {", (unsigned long long) stats->nallocs,
+            (unsigned long long) stats->nfrees);
+    for (size_t op = 0; op < LLIST_STATS_NOPS; op++) {
+        const llist__OpStats * s = &stats->ops[op];
+        fprintf(fd, "%s\"%s\": {\"count\": %llu, \"nodes\": %llu, \"latency_ns_log2\": [", op == 0 ? "" : ", ",
+                names[op], (unsigned long long) s->count, (unsigned long long) s->nodes);
+        for (size_t b = 0; b < LLIST_STATS_NBUCKETS; b++) {
+            fprintf(fd, "%s%llu", b == 0 ? "" : ", ", (unsigned long long) s->latency[b]);
+        }
+        fprintf(fd, "]}");
+    }
+    fprintf(fd, "}}\n");
+}
+
+void llist__stats_reset (LinkedList * lst) {
+#ifdef LLIST_STATS
+    if (lst != NULL) {
+        lst->stats = (llist__Stats) { .nallocs = 0 };
+        return;
+    }
+    for (size_t op = 0; op < LLIST_STATS_NOPS; op++) {
+        atomic_store_explicit(&stats_global.ops[op].count, 0, memory_order_relaxed);
+        atomic_store_explicit(&stats_global.ops[op].nodes, 0, memory_order_relaxed);
+        for (size_t b = 0; b < LLIST_STATS_NBUCKETS; b++) {
+            atomic_store_explicit(&stats_global.ops[op].latency[b], 0, memory_order_relaxed);
+        }
+    }
+    atomic_store_explicit(&stats_global.nallocs, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats_global.nfrees, 0, memory_order_relaxed);
+#else
+    (void) lst;
+#endif
+}
+
+void llist__set_indexed (LinkedList * lst, const bool indexed) {
+    if (!llist__try_set_indexed(lst, indexed)) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list index.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void llist__set_keyed (LinkedList * lst, const llist__KeyOps * ops) {
+    if (!llist__try_set_keyed(lst, ops)) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list keys.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void llist__set_prefetch (LinkedList * lst, const size_t distance, const bool payloads) {
+    if (!llist__try_set_prefetch(lst, distance, payloads)) {
+        fprintf(stderr, "Something went wrong allocating memory for linked list lookahead.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void llist__shrink_to_fit (LinkedList * lst) {
+    spares_release(lst);
+    lst->maxspares = 0;
+}
+
+bool llist__try_append (LinkedList * lst, void * item) {
+    return llist__try_insert(lst->nelems, item, lst);
+}
+
+LinkedList * llist__try_create (const llist__Allocator * allocator) {
+    assert((allocator == NULL || (allocator->alloc != NULL && allocator->free != NULL)) &&
+           "Expected an allocator to provide both alloc and free\n");
+    LinkedList * lst = list_try_create(allocator);
+    if (lst == NULL) {
+        errno = ENOMEM;
+    }
+    return lst;
+}
+
+bool llist__try_insert (const size_t pos, void * item, LinkedList * lst) {
+    assert(pos <= lst->nelems && "Can't insert element past the end of the list\n");
+    STATS_BEGIN();
+    Node * new = node_try_alloc(lst);
+    bool inserted = new != NULL && node_try_insert(lst, pos, new, item);
+    if (!inserted) {
+        if (new != NULL) {
+            node_free(lst, new);
+        }
+        errno = ENOMEM;
+    }
+    STATS_END(lst, LLIST_STATS_INSERT);
+    return inserted;
+}
+
+bool llist__try_prepend (LinkedList * lst, void * item) {
+    return llist__try_insert(0, item, lst);
+}
+
+bool llist__try_set_indexed (LinkedList * lst, const bool indexed) {
+    if (indexed && lst->index == NULL) {
+        Index * index = mem_alloc(&lst->allocator, sizeof(Index));
+        if (index == NULL) {
+            errno = ENOMEM;
+            return false;
+        }
+        for (size_t l = 0; l < INDEX_MAXLEVEL; l++) {
+            index->heads[l].next = NULL;
+        }
+        index->seed = 0x9e3779b97f4a7c15;
+        index->allocator = lst->allocator;
+        lst->index = index;
+        if (!index_try_build(lst)) {
+            mem_free(&lst->allocator, index, sizeof(Index));
+            lst->index = NULL;
+            errno = ENOMEM;
+            return false;
+        }
+    } else if (!indexed && lst->index != NULL) {
+        index_clear(lst->index);
+        mem_free(&lst->allocator, lst->index, sizeof(Index));
+        lst->index = NULL;
+    }
+    return true;
+}
+
+bool llist__try_set_keyed (LinkedList * lst, const llist__KeyOps * ops) {
+    Keys * old = lst->keys;
+    if (ops != NULL) {
+        // build the new table next to the old one, such that running out
+        // of memory leaves lst keyed as it was
+        assert(ops->hash != NULL && ops->equal != NULL && "Expected functions to hash and compare keys\n");
+        Keys * keys = mem_alloc(&lst->allocator, sizeof(Keys));
+        if (keys == NULL) {
+            errno = ENOMEM;
+            return false;
+        }
+        *keys = (Keys) { .stale = true, .ops = *ops, .allocator = lst->allocator, .slots = NULL };
+        lst->keys = keys;
+        if (!keys_try_build(lst)) {
+            mem_free(&lst->allocator, keys, sizeof(Keys));
+            lst->keys = old;
+            errno = ENOMEM;
+            return false;
+        }
+    } else {
+        lst->keys = NULL;
+    }
+    if (old != NULL) {
+        keys_clear(old);
+        mem_free(&lst->allocator, old, sizeof(Keys));
+    }
+    return true;
+}
+
+bool llist__try_set_prefetch (LinkedList * lst, const size_t distance, const bool payloads) {
+    if (distance == 0) {
+        if (lst->lookahead != NULL) {
+            Lookahead * la = lst->lookahead;
+            if (la->nodes != NULL) {
+                mem_free(&la->allocator, la->nodes, sizeof(Node *) * la->capacity);
+            }
+            mem_free(&lst->allocator, la, sizeof(Lookahead));
+            lst->lookahead = NULL;
+        }
+        return true;
+    }
+    if (lst->lookahead == NULL) {
+        Lookahead * la = mem_alloc(&lst->allocator, sizeof(Lookahead));
+        if (la == NULL) {
+            errno = ENOMEM;
+            return false;
+        }
+        *la = (Lookahead) { .valid = false, .nnodes = 0, .capacity = 0, .allocator = lst->allocator, .nodes = NULL };
+        lst->lookahead = la;
+    }
+    lst->lookahead->distance = distance;
+    lst->lookahead->payloads = payloads;
+    return true;
+}
+
+bool llist__write (const LinkedList * lst, const llist__WriteOptions * opts, int fd) {
+    static const llist__WriteOptions defaults = { .format = LLIST_FORMAT_POINTER };
+    if (opts == NULL) {
+        opts = &defaults;
+    }
+    assert(opts->precision <= 17 && "Can't write floating point payloads with more than 17 decimals\n");
+    Sink sink = { .buf = opts->buffer, .size = opts->bufsize, .len = 0, .fd = fd, .ok = true };
+    if (sink.buf == NULL) {
+        sink.buf = malloc(WRITE_BUFSIZE);
+        if (sink.buf == NULL) {
+            fprintf(stderr, "Something went wrong allocating memory for the write buffer.\n");
+            exit(EXIT_FAILURE);
+        }
+        sink.size = WRITE_BUFSIZE;
+    }
+    assert(sink.size >= WRITE_MAXELEM && "Expected a write buffer of at least 64 bytes\n");
+
+    if (opts->binary) {
+        uint64_t nelems = lst->nelems;
+        sink_put(&sink, &nelems, sizeof(nelems));
+    } else {
+        sink_put(&sink, "[", 1);
+    }
+    for (Node * curr = lst->firstnode; curr != NULL && sink.ok; curr = curr->next) {
+        if (!opts->binary && curr != lst->firstnode) {
+            sink_put(&sink, ", ", 2);
+        }
+        write_item(&sink, opts, curr->payload);
+    }
+    if (!opts->binary) {
+        sink_put(&sink, "]\n", 2);
+    }
+    sink_flush(&sink);
+
+    if (opts->buffer == NULL) {
+        free(sink.buf);
+    }
+    return sink.ok;
+}
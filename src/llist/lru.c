@@ -0,0 +1,122 @@
+#include "llist/lru.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LRU_NODES_PER_SLAB 4096
+
+typedef struct {
+    const void * key;
+    void * value;
+} Entry;
+
+struct llist__lru_cache {
+    size_t capacity;
+    LinkedList * lst;
+    llist__NodePool * pool;
+    void (*evict)(const void * key, void * value, void * ctx);
+    void * ctx;
+    Entry * entries;
+    Entry ** spares;
+    size_t nspares;
+};
+
+static const void * entry_key (const void * item, void *) {
+    return ((const Entry *) item)->key;
+}
+
+static void entry_evict (llist__LruCache * cache, Entry * entry) {
+    if (cache->evict != NULL) {
+        cache->evict(entry->key, entry->value, cache->ctx);
+    }
+}
+
+llist__LruCache * llist__lru_create (const size_t capacity, const llist__KeyOps * ops,
+                                     void (*evict)(const void * key, void * value, void * ctx), void * ctx) {
+    assert(capacity > 0 && "Expected the cache to hold at least one entry\n");
+    assert(ops->key == NULL && "Expected the cache to extract the keys of its entries itself\n");
+    llist__LruCache * cache = malloc(sizeof(llist__LruCache) * 1);
+    if (cache == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the LRU cache.\n");
+        exit(EXIT_FAILURE);
+    }
+    // the entries are allocated up front; spares holds the unused ones
+    cache->entries = malloc(sizeof(Entry) * capacity);
+    cache->spares = malloc(sizeof(Entry *) * capacity);
+    if (cache->entries == NULL || cache->spares == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the LRU cache entries.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        cache->spares[i] = &cache->entries[capacity - 1 - i];
+    }
+    cache->nspares = capacity;
+    cache->capacity = capacity;
+    cache->evict = evict;
+    cache->ctx = ctx;
+    cache->pool = llist__pool_create(capacity < LRU_NODES_PER_SLAB ? capacity : LRU_NODES_PER_SLAB);
+    cache->lst = llist__create_with_pool(cache->pool);
+    llist__KeyOps keyops = *ops;
+    keyops.key = entry_key;
+    llist__set_keyed(cache->lst, &keyops);
+    return cache;
+}
+
+void llist__lru_destroy (llist__LruCache ** cache) {
+    while (llist__lru_evict(*cache)) {}
+    llist__destroy(&(*cache)->lst);
+    llist__pool_destroy(&(*cache)->pool);
+    free((*cache)->entries);
+    free((*cache)->spares);
+    free(*cache);
+    *cache = NULL;
+}
+
+bool llist__lru_evict (llist__LruCache * cache) {
+    if (llist__get_length(cache->lst) == 0) return false;
+    Entry * entry = llist__pop_back(cache->lst);
+    cache->spares[cache->nspares++] = entry;
+    entry_evict(cache, entry);
+    return true;
+}
+
+void * llist__lru_get (llist__LruCache * cache, const void * key) {
+    Entry * entry = llist__move_to_front(cache->lst, key);
+    return entry == NULL ? NULL : entry->value;
+}
+
+size_t llist__lru_get_length (const llist__LruCache * cache) {
+    return llist__get_length(cache->lst);
+}
+
+void llist__lru_put (llist__LruCache * cache, const void * key, void * value) {
+    Entry * entry = llist__move_to_front(cache->lst, key);
+    if (entry != NULL) {
+        // equal keys hash alike, so swapping the key keeps the entry keyed
+        Entry old = *entry;
+        entry->key = key;
+        entry->value = value;
+        entry_evict(cache, &old);
+        return;
+    }
+    if (cache->nspares == 0) {
+        entry = llist__pop_back(cache->lst);
+        entry_evict(cache, entry);
+    } else {
+        entry = cache->spares[--cache->nspares];
+    }
+    entry->key = key;
+    entry->value = value;
+    llist__prepend(cache->lst, entry);
+}
+
+void * llist__lru_remove (llist__LruCache * cache, const void * key) {
+    Entry * entry = llist__delete_key(cache->lst, key);
+    if (entry == NULL) return NULL;
+    cache->spares[cache->nspares++] = entry;
+    return entry->value;
+}
+
+bool llist__lru_touch (llist__LruCache * cache, const void * key) {
+    return llist__move_to_front(cache->lst, key) != NULL;
+}
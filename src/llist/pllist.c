@@ -0,0 +1,148 @@
+#include "llist/pllist.h"
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct pllist__node PNode;
+
+struct pllist__node {
+    atomic_size_t refs;
+    void * payload;
+    PNode * next;
+};
+
+struct pllist {
+    atomic_size_t refs;
+    size_t nelems;
+    PNode * head;
+};
+
+static PNode * node_retain (PNode * node) {
+    if (node != NULL) {
+        atomic_fetch_add_explicit(&node->refs, 1, memory_order_relaxed);
+    }
+    return node;
+}
+
+static void node_release (PNode * node) {
+    // free the nodes that only this reference kept alive; the first
+    // node that is still shared stops the walk
+    while (node != NULL && atomic_fetch_sub_explicit(&node->refs, 1, memory_order_release) == 1) {
+        atomic_thread_fence(memory_order_acquire);
+        PNode * next = node->next;
+        free(node);
+        node = next;
+    }
+}
+
+static PersistentList * version_create (PNode * head, const size_t nelems) {
+    PersistentList * lst = malloc(sizeof(PersistentList) * 1);
+    if (lst == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the persistent linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_init(&lst->refs, 1);
+    lst->nelems = nelems;
+    lst->head = head;
+    return lst;
+}
+
+PersistentList * pllist__create (void) {
+    return version_create(NULL, 0);
+}
+
+void pllist__destroy (PersistentList ** lst) {
+    if (atomic_fetch_sub_explicit(&(*lst)->refs, 1, memory_order_release) == 1) {
+        atomic_thread_fence(memory_order_acquire);
+        node_release((*lst)->head);
+        free(*lst);
+    }
+    *lst = NULL;
+}
+
+void * pllist__first (const PersistentList * lst) {
+    assert(lst->nelems > 0 && "Can't get the first item of an empty list\n");
+    return lst->head->payload;
+}
+
+void * pllist__get (const size_t pos, const PersistentList * lst) {
+    assert(pos < lst->nelems && "Can't get item past the end of the list\n");
+    const PNode * curr = lst->head;
+    for (size_t i = 0; i < pos; i++) {
+        curr = curr->next;
+    }
+    return curr->payload;
+}
+
+size_t pllist__get_length (const PersistentList * lst) {
+    return lst->nelems;
+}
+
+pllist__Iter pllist__iter_begin (const PersistentList * lst) {
+    return (pllist__Iter) { .next = lst->head, .item = NULL };
+}
+
+void * pllist__iter_get (const pllist__Iter * it) {
+    return it->item;
+}
+
+bool pllist__iter_next (pllist__Iter * it) {
+    if (it->next == NULL) return false;
+    it->item = it->next->payload;
+    it->next = it->next->next;
+    return true;
+}
+
+PersistentList * pllist__pop_front (const PersistentList * lst, void ** item) {
+    assert(lst->nelems > 0 && "Can't pop an item from an empty list\n");
+    if (item != NULL) {
+        *item = lst->head->payload;
+    }
+    return version_create(node_retain(lst->head->next), lst->nelems - 1);
+}
+
+PersistentList * pllist__prepend (const PersistentList * lst, void * item) {
+    PNode * node = malloc(sizeof(PNode) * 1);
+    if (node == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for the persistent linked list node.\n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_init(&node->refs, 1);
+    node->payload = item;
+    node->next = node_retain(lst->head);
+    return version_create(node, lst->nelems + 1);
+}
+
+void pllist__print (const PersistentList * lst, const llist__Printers * printers, FILE * fd) {
+
+    // -- print preamble
+    if (printers == NULL || printers->pre == NULL) {
+        fprintf(fd, "[");
+    } else {
+        printers->pre(fd, lst->nelems);
+    }
+
+    // -- print each elem
+    const PNode * curr = lst->head;
+    for (size_t i = 0; i < lst->nelems; i++) {
+        if (printers == NULL || printers->elem == NULL) {
+            fprintf(fd, "%p%s", curr->payload, i == lst->nelems - 1 ? "" : ", ");
+        } else {
+            printers->elem(fd, i, lst->nelems, curr->payload);
+        }
+        curr = curr->next;
+    }
+
+    // -- print postamble
+    if (printers == NULL || printers->post == NULL) {
+        fprintf(fd, "]\n");
+    } else {
+        printers->post(fd, lst->nelems);
+    }
+}
+
+PersistentList * pllist__snapshot (PersistentList * lst) {
+    atomic_fetch_add_explicit(&lst->refs, 1, memory_order_relaxed);
+    return lst;
+}
@@ -0,0 +1,265 @@
+#include "llist/ullist.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct chunk Chunk;
+
+struct chunk {
+    struct chunk * next;
+    struct chunk * prev;
+    size_t count;
+    void * items[ULLIST_CHUNK_CAPACITY];
+};
+
+struct ullist {
+    size_t nelems;
+    Chunk * firstchunk;
+    Chunk * lastchunk;
+};
+
+static Chunk * chunk_alloc (void) {
+    Chunk * chunk = malloc(sizeof(Chunk) * 1);
+    if (chunk == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for new chunk in unrolled linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    chunk->count = 0;
+    return chunk;
+}
+
+static Chunk * chunk_at (const UnrolledList * lst, size_t pos, size_t * offset) {
+    // walk from whichever end of the list is closest to pos
+    assert(pos < lst->nelems && "Can't get chunk past the end of the list\n");
+    Chunk * curr = NULL;
+    if (pos < lst->nelems / 2) {
+        curr = lst->firstchunk;
+        while (pos >= curr->count) {
+            pos -= curr->count;
+            curr = curr->next;
+        }
+        *offset = pos;
+    } else {
+        size_t remaining = lst->nelems - pos;
+        curr = lst->lastchunk;
+        while (remaining > curr->count) {
+            remaining -= curr->count;
+            curr = curr->prev;
+        }
+        *offset = curr->count - remaining;
+    }
+    return curr;
+}
+
+static void chunk_link (UnrolledList * lst, Chunk * prev, Chunk * chunk, Chunk * next) {
+    // link chunk in between prev and next, either of which may be NULL
+    chunk->prev = prev;
+    chunk->next = next;
+    if (prev == NULL) {
+        lst->firstchunk = chunk;
+    } else {
+        prev->next = chunk;
+    }
+    if (next == NULL) {
+        lst->lastchunk = chunk;
+    } else {
+        next->prev = chunk;
+    }
+}
+
+static void chunk_unlink (UnrolledList * lst, Chunk * chunk) {
+    if (chunk->prev == NULL) {
+        lst->firstchunk = chunk->next;
+    } else {
+        chunk->prev->next = chunk->next;
+    }
+    if (chunk->next == NULL) {
+        lst->lastchunk = chunk->prev;
+    } else {
+        chunk->next->prev = chunk->prev;
+    }
+    free(chunk);
+}
+
+static bool chunk_merge (UnrolledList * lst, Chunk * dst, Chunk * src) {
+    // move all items from src to the end of dst if they fit, and drop src
+    if (dst == NULL || src == NULL || dst->count + src->count > ULLIST_CHUNK_CAPACITY) return false;
+    memcpy(&dst->items[dst->count], &src->items[0], sizeof(void *) * src->count);
+    dst->count += src->count;
+    chunk_unlink(lst, src);
+    return true;
+}
+
+void ullist__append (UnrolledList * lst, void * item) {
+    ullist__insert(lst->nelems, item, lst);
+}
+
+UnrolledList * ullist__create (void) {
+    UnrolledList * lst = malloc(sizeof(UnrolledList) * 1);
+    if (lst == NULL) {
+        fprintf(stderr, "Something went wrong allocating memory for unrolled linked list.\n");
+        exit(EXIT_FAILURE);
+    }
+    lst->nelems = 0;
+    lst->firstchunk = NULL;
+    lst->lastchunk = NULL;
+    return lst;
+}
+
+void ullist__delete (const bool global, UnrolledList * lst, bool (*filter)(void *)) {
+    Chunk * curr = lst->firstchunk;
+    while (curr != NULL) {
+        Chunk * next = curr->next;
+        bool deleted = false;
+        size_t nkept = 0;
+        for (size_t i = 0; i < curr->count; i++) {
+            if ((global || !deleted) && filter(curr->items[i])) {
+                deleted = true;
+                lst->nelems--;
+            } else {
+                if (nkept != i) {
+                    curr->items[nkept] = curr->items[i];
+                }
+                nkept++;
+            }
+        }
+        curr->count = nkept;
+        if (curr->count == 0) {
+            chunk_unlink(lst, curr);
+        } else if (!chunk_merge(lst, curr->prev, curr) && deleted && !global) {
+            // items beyond curr have not been filtered in global mode, so
+            // only merge the next chunk when this is the last deletion
+            chunk_merge(lst, curr, next);
+        }
+        if (deleted && !global) return;
+        curr = next;
+    }
+}
+
+void ullist__destroy (UnrolledList ** lst) {
+    Chunk * curr = (*lst)->firstchunk;
+    while (curr != NULL) {
+        Chunk * tmp = curr;
+        curr = curr->next;
+        (*lst)->nelems -= tmp->count;
+        free(tmp);
+    }
+    assert((*lst)->nelems == 0 && "Expected number of elements in unrolled linked list to be 0 after clearing all items.\n");
+    free(*lst);
+    *lst = NULL;
+}
+
+void ullist__insert (const size_t pos, void * item, UnrolledList * lst) {
+    assert(pos <= lst->nelems && "Can't insert element past the end of the list\n");
+
+    Chunk * chunk = NULL;
+    size_t offset = 0;
+    if (pos < lst->nelems) {
+        chunk = chunk_at(lst, pos, &offset);
+    } else if (lst->lastchunk != NULL) {
+        chunk = lst->lastchunk;
+        offset = chunk->count;
+    }
+
+    if (chunk == NULL) {
+        // list is empty
+        chunk = chunk_alloc();
+        chunk_link(lst, NULL, chunk, NULL);
+    } else if (chunk->count == ULLIST_CHUNK_CAPACITY) {
+        if (offset == ULLIST_CHUNK_CAPACITY) {
+            // appending to a full chunk starts a new chunk after it
+            Chunk * new = chunk_alloc();
+            chunk_link(lst, chunk, new, chunk->next);
+            chunk = new;
+            offset = 0;
+        } else if (offset == 0 && chunk->prev != NULL && chunk->prev->count < ULLIST_CHUNK_CAPACITY) {
+            // prepending to a full chunk can use the room left in the previous one
+            chunk = chunk->prev;
+            offset = chunk->count;
+        } else if (offset == 0) {
+            Chunk * new = chunk_alloc();
+            chunk_link(lst, chunk->prev, new, chunk);
+            chunk = new;
+        } else {
+            // split the full chunk in two halves
+            Chunk * new = chunk_alloc();
+            size_t half = ULLIST_CHUNK_CAPACITY / 2;
+            new->count = ULLIST_CHUNK_CAPACITY - half;
+            memcpy(&new->items[0], &chunk->items[half], sizeof(void *) * new->count);
+            chunk->count = half;
+            chunk_link(lst, chunk, new, chunk->next);
+            if (offset > half) {
+                chunk = new;
+                offset -= half;
+            }
+        }
+    }
+
+    memmove(&chunk->items[offset + 1], &chunk->items[offset], sizeof(void *) * (chunk->count - offset));
+    chunk->items[offset] = item;
+    chunk->count++;
+    lst->nelems++;
+}
+
+size_t ullist__get_length (const UnrolledList * lst) {
+    return lst->nelems;
+}
+
+void * ullist__pop_back (UnrolledList * lst) {
+    assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");
+    Chunk * chunk = lst->lastchunk;
+    void * item = chunk->items[chunk->count - 1];
+    chunk->count--;
+    lst->nelems--;
+    if (chunk->count == 0) {
+        chunk_unlink(lst, chunk);
+    }
+    return item;
+}
+
+void * ullist__pop_front (UnrolledList * lst) {
+    assert(lst->nelems > 0 && "Can't pop an element from an empty list\n");
+    Chunk * chunk = lst->firstchunk;
+    void * item = chunk->items[0];
+    chunk->count--;
+    lst->nelems--;
+    memmove(&chunk->items[0], &chunk->items[1], sizeof(void *) * chunk->count);
+    if (chunk->count == 0) {
+        chunk_unlink(lst, chunk);
+    }
+    return item;
+}
+
+void ullist__prepend (UnrolledList * lst, void * item) {
+    ullist__insert(0, item, lst);
+}
+
+void ullist__print (const UnrolledList * lst, const llist__Printers * printers, FILE * fd) {
+
+    // -- print preamble
+    if (printers == NULL || printers->pre == NULL) {
+        fprintf(fd, "[");
+    } else {
+        printers->pre(fd, lst->nelems);
+    }
+
+    // -- print each elem
+    size_t i = 0;
+    for (Chunk * curr = lst->firstchunk; curr != NULL; curr = curr->next) {
+        for (size_t j = 0; j < curr->count; j++, i++) {
+            if (printers == NULL || printers->elem == NULL) {
+                fprintf(fd, "%p%s", curr->items[j], i == lst->nelems - 1 ? "" : ", ");
+            } else {
+                printers->elem(fd, i, lst->nelems, curr->items[j]);
+            }
+        }
+    }
+
+    // -- print postamble
+    if (printers == NULL || printers->post == NULL) {
+        fprintf(fd, "]\n");
+    } else {
+        printers->post(fd, lst->nelems);
+    }
+}
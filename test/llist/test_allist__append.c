@@ -0,0 +1,51 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(0);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(allist__append, four_items, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    allist__append(lst, (void *) &arr[0]);
+    allist__append(lst, (void *) &arr[1]);
+    allist__append(lst, (void *) &arr[2]);
+    allist__append(lst, (void *) &arr[3]);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
+
+Test(allist__append, grows_past_capacity, .init = setup, .fini = teardown) {
+    // the list starts without slots and is relocated several times
+    int arr[1000];
+    constexpr size_t n = sizeof(arr) / sizeof(arr[0]);
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int) i;
+        allist__append(lst, (void *) &arr[i]);
+    }
+    cr_assert(allist__get_length(lst) == n, "Expected %zu items.\n", n);
+    for (size_t i = 0; i < n; i++) {
+        cr_assert(allist__pop_front(lst) == &arr[i], "Expected item %zu to come out in order.\n", i);
+    }
+}
@@ -0,0 +1,42 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(4);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(allist__create, empty, .init = setup, .fini = teardown) {
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[]\n");
+}
+
+Test(allist__create, without_capacity, .init = setup, .fini = teardown) {
+    ArrayLinkedList * other = allist__create(0);
+    cr_assert(allist__get_length(other) == 0, "Expected the list to be empty.\n");
+    int item = 100;
+    allist__prepend(other, (void *) &item);
+    cr_assert(allist__get(0, other) == &item, "Expected the item to be stored.\n");
+    allist__destroy(&other);
+    cr_assert(other == NULL, "Expected the pointer to be reset.\n");
+}
@@ -0,0 +1,71 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(4);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static void fill (void) {
+    setup();
+    allist__append(lst, (void *) &arr[0]);
+    allist__append(lst, (void *) &arr[1]);
+    allist__append(lst, (void *) &arr[2]);
+    allist__append(lst, (void *) &arr[3]);
+}
+
+static bool filter (void * p) {
+    return *((int *) p) % 2 == 0;
+}
+
+Test(allist__delete, global, .init = fill, .fini = teardown) {
+    allist__delete(true, lst, filter);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 103]\n");
+}
+
+Test(allist__delete, local, .init = fill, .fini = teardown) {
+    allist__delete(false, lst, filter);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n");
+}
+
+static bool all (void *) {
+    return true;
+}
+
+Test(allist__delete, all_then_refill, .init = fill, .fini = teardown) {
+    // the freed slots are reused, in whatever order the freelist hands them out
+    allist__delete(true, lst, all);
+    cr_assert(allist__get_length(lst) == 0, "Expected the list to be empty.\n");
+    allist__prepend(lst, (void *) &arr[2]);
+    allist__append(lst, (void *) &arr[3]);
+    allist__prepend(lst, (void *) &arr[1]);
+    allist__prepend(lst, (void *) &arr[0]);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
@@ -0,0 +1,30 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+
+static ArrayLinkedList * lst = NULL;
+
+static int arr[] = { 100, 101, 102, 103, 104 };
+
+static void setup (void) {
+    lst = allist__create(5);
+    for (size_t i = 0; i < 5; i++) {
+        allist__append(lst, (void *) &arr[i]);
+    }
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+Test(allist__get, every_position, .init = setup, .fini = teardown) {
+    // the first half is reached from the head, the second from the tail
+    for (size_t i = 0; i < 5; i++) {
+        cr_assert(allist__get(i, lst) == &arr[i], "Expected item %zu at position %zu.\n", i, i);
+    }
+}
+
+Test(allist__get, after_remove, .init = setup, .fini = teardown) {
+    allist__remove(1, lst);
+    cr_assert(allist__get(1, lst) == &arr[2], "Expected the items after the removed one to move up.\n");
+    cr_assert(allist__get(3, lst) == &arr[4], "Expected the last item at the last position.\n");
+}
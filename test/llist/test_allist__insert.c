@@ -0,0 +1,57 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(2);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(allist__insert, four_items_out_of_order, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    allist__insert(0, (void *) &arr[2], lst);
+    allist__insert(0, (void *) &arr[0], lst);
+    allist__insert(2, (void *) &arr[3], lst);
+    allist__insert(1, (void *) &arr[1], lst);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
+
+Test(allist__insert, many_positions, .init = setup, .fini = teardown) {
+    // mirror every insertion in a plain array and compare afterwards
+    int arr[200];
+    int * expected[200];
+    constexpr size_t n = sizeof(arr) / sizeof(arr[0]);
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int) i;
+        size_t pos = (i * 7) % (i + 1);
+        for (size_t j = i; j > pos; j--) {
+            expected[j] = expected[j - 1];
+        }
+        expected[pos] = &arr[i];
+        allist__insert(pos, (void *) &arr[i], lst);
+    }
+    cr_assert(allist__get_length(lst) == n, "Expected %zu items.\n", n);
+    for (size_t i = 0; i < n; i++) {
+        cr_assert(allist__pop_front(lst) == expected[i], "Expected item %zu to be in its inserted position.\n", i);
+    }
+}
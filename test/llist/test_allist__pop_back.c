@@ -0,0 +1,53 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(4);
+    allist__append(lst, (void *) &arr[0]);
+    allist__append(lst, (void *) &arr[1]);
+    allist__append(lst, (void *) &arr[2]);
+    allist__append(lst, (void *) &arr[3]);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(allist__pop_back, one_item, .init = setup, .fini = teardown) {
+    int * actual = allist__pop_back(lst);
+    cr_assert(actual == &arr[3], "Expected the last item to be returned.\n");
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102]\n");
+}
+
+Test(allist__pop_back, all_items_then_prepend, .init = setup, .fini = teardown) {
+    allist__pop_back(lst);
+    allist__pop_back(lst);
+    allist__pop_back(lst);
+    allist__pop_back(lst);
+    cr_assert(allist__get_length(lst) == 0, "Expected the list to be empty after popping all items.\n");
+    allist__prepend(lst, (void *) &arr[1]);
+    allist__prepend(lst, (void *) &arr[0]);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101]\n");
+}
@@ -0,0 +1,51 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(4);
+    allist__append(lst, (void *) &arr[0]);
+    allist__append(lst, (void *) &arr[1]);
+    allist__append(lst, (void *) &arr[2]);
+    allist__append(lst, (void *) &arr[3]);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(allist__pop_front, one_item, .init = setup, .fini = teardown) {
+    int * actual = allist__pop_front(lst);
+    cr_assert(actual == &arr[0], "Expected the first item to be returned.\n");
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n");
+}
+
+Test(allist__pop_front, steady_state_queue, .init = setup, .fini = teardown) {
+    // popping at the front and appending at the back recycles the same slots
+    for (size_t i = 0; i < 1000; i++) {
+        int * item = allist__pop_front(lst);
+        allist__append(lst, (void *) item);
+    }
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
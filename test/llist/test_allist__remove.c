@@ -0,0 +1,50 @@
+#include "llist/allist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static ArrayLinkedList * lst = NULL;
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = allist__create(4);
+    allist__append(lst, (void *) &arr[0]);
+    allist__append(lst, (void *) &arr[1]);
+    allist__append(lst, (void *) &arr[2]);
+    allist__append(lst, (void *) &arr[3]);
+}
+
+static void teardown (void) {
+    allist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(allist__remove, middle_items, .init = setup, .fini = teardown) {
+    cr_assert(allist__remove(1, lst) == &arr[1], "Expected the second item to be returned.\n");
+    cr_assert(allist__remove(1, lst) == &arr[2], "Expected the third item to be returned.\n");
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 103]\n");
+}
+
+Test(allist__remove, then_insert, .init = setup, .fini = teardown) {
+    allist__remove(3, lst);
+    allist__remove(0, lst);
+    allist__insert(2, (void *) &arr[3], lst);
+    allist__insert(0, (void *) &arr[0], lst);
+    allist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
@@ -0,0 +1,96 @@
+#include "llist/cllist.h"
+#include <criterion/criterion.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#define NTHREADS 4
+#define NITEMS_PER_THREAD 20000
+
+typedef struct {
+    size_t producer;
+    size_t seqno;
+} Message;
+
+static ConcurrentQueue * q = NULL;
+
+static Message arr[NTHREADS * NITEMS_PER_THREAD];
+
+static atomic_int seen[NTHREADS * NITEMS_PER_THREAD];
+
+static atomic_size_t npopped = 0;
+
+static atomic_bool out_of_order = false;
+
+static void setup (void) {
+    q = cllist__queue_create();
+}
+
+static void teardown (void) {
+    cllist__queue_destroy(&q);
+}
+
+static int producer (void * p) {
+    size_t id = *((size_t *) p);
+    for (size_t i = 0; i < NITEMS_PER_THREAD; i++) {
+        Message * msg = &arr[id * NITEMS_PER_THREAD + i];
+        msg->producer = id;
+        msg->seqno = i;
+        cllist__queue_append(q, (void *) msg);
+    }
+    return 0;
+}
+
+static int consumer (void *) {
+    // messages from any one producer must arrive in the order they were sent
+    size_t last[NTHREADS] = { 0 };
+    bool any[NTHREADS] = { false };
+    while (atomic_load(&npopped) < NTHREADS * NITEMS_PER_THREAD) {
+        void * item = NULL;
+        if (cllist__queue_pop_front(q, &item)) {
+            Message * msg = item;
+            if (any[msg->producer] && msg->seqno <= last[msg->producer]) {
+                atomic_store(&out_of_order, true);
+            }
+            any[msg->producer] = true;
+            last[msg->producer] = msg->seqno;
+            atomic_fetch_add(&seen[msg - &arr[0]], 1);
+            atomic_fetch_add(&npopped, 1);
+        }
+    }
+    return 0;
+}
+
+Test(cllist__queue_pop_front, fifo, .init = setup, .fini = teardown) {
+    int items[] = { 100, 101, 102 };
+    void * item = NULL;
+    cr_assert(!cllist__queue_pop_front(q, &item), "Expected an empty queue to yield nothing.\n");
+    cllist__queue_append(q, (void *) &items[0]);
+    cllist__queue_append(q, (void *) &items[1]);
+    cllist__queue_append(q, (void *) &items[2]);
+    for (size_t i = 0; i < 3; i++) {
+        cr_assert(cllist__queue_pop_front(q, &item), "Expected the queue to yield an item.\n");
+        cr_assert(item == &items[i], "Expected items in order of appending.\n");
+    }
+    cr_assert(!cllist__queue_pop_front(q, &item), "Expected an empty queue to yield nothing.\n");
+}
+
+Test(cllist__queue_pop_front, concurrent_producers_and_consumers, .init = setup, .fini = teardown) {
+    thrd_t producers[NTHREADS];
+    thrd_t consumers[NTHREADS];
+    size_t ids[NTHREADS];
+    for (size_t t = 0; t < NTHREADS; t++) {
+        ids[t] = t;
+        thrd_create(&consumers[t], consumer, NULL);
+        thrd_create(&producers[t], producer, &ids[t]);
+    }
+    for (size_t t = 0; t < NTHREADS; t++) {
+        thrd_join(producers[t], NULL);
+        thrd_join(consumers[t], NULL);
+    }
+    cr_assert(!atomic_load(&out_of_order), "Expected every producer's messages to arrive in order.\n");
+    for (size_t i = 0; i < NTHREADS * NITEMS_PER_THREAD; i++) {
+        cr_assert(atomic_load(&seen[i]) == 1, "Expected message %zu to be popped exactly once.\n", i);
+    }
+    void * item = NULL;
+    cr_assert(!cllist__queue_pop_front(q, &item), "Expected the queue to be empty.\n");
+}
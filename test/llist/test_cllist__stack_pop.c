@@ -0,0 +1,76 @@
+#include "llist/cllist.h"
+#include <criterion/criterion.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#define NTHREADS 4
+#define NITEMS_PER_THREAD 20000
+
+static ConcurrentStack * s = NULL;
+
+static int arr[NTHREADS * NITEMS_PER_THREAD];
+
+static atomic_int seen[NTHREADS * NITEMS_PER_THREAD];
+
+static atomic_size_t npopped = 0;
+
+static void setup (void) {
+    s = cllist__stack_create();
+}
+
+static void teardown (void) {
+    cllist__stack_destroy(&s);
+}
+
+static int producer (void * p) {
+    size_t offset = *((size_t *) p) * NITEMS_PER_THREAD;
+    for (size_t i = 0; i < NITEMS_PER_THREAD; i++) {
+        cllist__stack_push(s, (void *) &arr[offset + i]);
+    }
+    return 0;
+}
+
+static int consumer (void *) {
+    while (atomic_load(&npopped) < NTHREADS * NITEMS_PER_THREAD) {
+        void * item = NULL;
+        if (cllist__stack_pop(s, &item)) {
+            atomic_fetch_add(&seen[(int *) item - &arr[0]], 1);
+            atomic_fetch_add(&npopped, 1);
+        }
+    }
+    return 0;
+}
+
+Test(cllist__stack_pop, lifo, .init = setup, .fini = teardown) {
+    int items[] = { 100, 101, 102 };
+    void * item = NULL;
+    cr_assert(!cllist__stack_pop(s, &item), "Expected an empty stack to yield nothing.\n");
+    cllist__stack_push(s, (void *) &items[0]);
+    cllist__stack_push(s, (void *) &items[1]);
+    cllist__stack_push(s, (void *) &items[2]);
+    for (size_t i = 3; i-- > 0;) {
+        cr_assert(cllist__stack_pop(s, &item), "Expected the stack to yield an item.\n");
+        cr_assert(item == &items[i], "Expected items in reverse order of pushing.\n");
+    }
+    cr_assert(!cllist__stack_pop(s, &item), "Expected an empty stack to yield nothing.\n");
+}
+
+Test(cllist__stack_pop, concurrent_producers_and_consumers, .init = setup, .fini = teardown) {
+    thrd_t producers[NTHREADS];
+    thrd_t consumers[NTHREADS];
+    size_t ids[NTHREADS];
+    for (size_t t = 0; t < NTHREADS; t++) {
+        ids[t] = t;
+        thrd_create(&consumers[t], consumer, NULL);
+        thrd_create(&producers[t], producer, &ids[t]);
+    }
+    for (size_t t = 0; t < NTHREADS; t++) {
+        thrd_join(producers[t], NULL);
+        thrd_join(consumers[t], NULL);
+    }
+    for (size_t i = 0; i < NTHREADS * NITEMS_PER_THREAD; i++) {
+        cr_assert(atomic_load(&seen[i]) == 1, "Expected item %zu to be popped exactly once.\n", i);
+    }
+    void * item = NULL;
+    cr_assert(!cllist__stack_pop(s, &item), "Expected the stack to be empty.\n");
+}
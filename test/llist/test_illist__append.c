@@ -0,0 +1,59 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__append, to_empty) {
+    cr_redirect_stdout();
+    IntrusiveList * empty = illist__create();
+    Item item = { .id = 7 };
+    illist__append(empty, &item.link);
+    cr_assert(illist__get_length(empty) == 1, "Expected the list to hold one link.\n");
+    illist__print(empty, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[7]\n");
+    illist__destroy(&empty);
+}
+
+Test(illist__append, to_populated, .init = setup, .fini = teardown) {
+    Item item = { .id = 104 };
+    illist__append(lst, &item.link);
+    cr_assert(illist__last(lst) == &item.link, "Expected the appended link to come last.\n");
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104]\n");
+    illist__unlink(lst, &item.link);
+}
@@ -0,0 +1,57 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool filter (llist__Link * link) {
+    return LLIST_CONTAINER_OF(link, Item, link)->id > 100;
+}
+
+Test(illist__delete, first, .init = setup, .fini = teardown) {
+    illist__delete(false, lst, filter);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 103]\n");
+    cr_assert(items[1].link.next == NULL && items[1].link.prev == NULL, "Expected the unlinked link to be reset.\n");
+}
+
+Test(illist__delete, global, .init = setup, .fini = teardown) {
+    illist__delete(true, lst, filter);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100]\n");
+    cr_assert(illist__last(lst) == &items[0].link, "Expected the remaining link to be the last one too.\n");
+}
@@ -0,0 +1,23 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+Test(illist__destroy, empty) {
+    IntrusiveList * lst = illist__create();
+    illist__destroy(&lst);
+    cr_assert(lst == NULL, "Expected the list pointer to be reset.\n");
+}
+
+Test(illist__destroy, leaves_items_alone) {
+    IntrusiveList * lst = illist__create();
+    Item item = { .id = 7 };
+    illist__append(lst, &item.link);
+    illist__destroy(&lst);
+    cr_assert(lst == NULL, "Expected the list pointer to be reset.\n");
+    cr_assert(item.id == 7, "Expected the item to be untouched.\n");
+    cr_assert(item.link.next == NULL && item.link.prev == NULL, "Expected the link to be reset.\n");
+}
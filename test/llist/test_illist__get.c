@@ -0,0 +1,53 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__get, each_position, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 4; i++) {
+        cr_assert(illist__get(i, lst) == &items[i].link, "Expected to get the link at each position.\n");
+    }
+}
+
+Test(illist__get, after_insert, .init = setup, .fini = teardown) {
+    Item item = { .id = 1 };
+    illist__insert(2, &item.link, lst);
+    cr_assert(illist__get(2, lst) == &item.link, "Expected to get the inserted link.\n");
+    illist__unlink(lst, &item.link);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
@@ -0,0 +1,50 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__insert, front_middle_end, .init = setup, .fini = teardown) {
+    Item extra[] = { { .id = 1 }, { .id = 2 }, { .id = 3 } };
+    illist__insert(0, &extra[0].link, lst);
+    illist__insert(3, &extra[1].link, lst);
+    illist__insert(6, &extra[2].link, lst);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[1, 100, 101, 2, 102, 103, 3]\n");
+    for (size_t i = 0; i < 3; i++) {
+        illist__unlink(lst, &extra[i].link);
+    }
+}
@@ -0,0 +1,51 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__insert_after, front_and_middle, .init = setup, .fini = teardown) {
+    Item extra[] = { { .id = 1 }, { .id = 2 }, { .id = 3 } };
+    illist__insert_after(lst, NULL, &extra[0].link);
+    illist__insert_after(lst, &items[1].link, &extra[1].link);
+    illist__insert_after(lst, &items[3].link, &extra[2].link);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[1, 100, 101, 2, 102, 103, 3]\n");
+    cr_assert(illist__last(lst) == &extra[2].link, "Expected the last link to be updated.\n");
+    for (size_t i = 0; i < 3; i++) {
+        illist__unlink(lst, &extra[i].link);
+    }
+}
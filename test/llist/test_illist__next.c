@@ -0,0 +1,58 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__next, walks_both_ways, .init = setup, .fini = teardown) {
+    int sum = 0;
+    for (llist__Link * l = illist__first(lst); l != NULL; l = illist__next(l)) {
+        sum += LLIST_CONTAINER_OF(l, Item, link)->id;
+    }
+    cr_assert(sum == 406, "Expected the forward walk to visit every item.\n");
+    int expected = 103;
+    for (llist__Link * l = illist__last(lst); l != NULL; l = illist__prev(l)) {
+        cr_assert(LLIST_CONTAINER_OF(l, Item, link)->id == expected--, "Expected the backward walk in order.\n");
+    }
+}
+
+Test(illist__next, after_unlink, .init = setup, .fini = teardown) {
+    illist__unlink(lst, &items[1].link);
+    cr_assert(illist__next(&items[0].link) == &items[2].link, "Expected the neighbors to be joined.\n");
+    cr_assert(illist__prev(&items[2].link) == &items[0].link, "Expected the neighbors to be joined.\n");
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 103]\n");
+}
@@ -0,0 +1,52 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__pop_back, all_items, .init = setup, .fini = teardown) {
+    for (int i = 3; i >= 0; i--) {
+        cr_assert(illist__pop_back(lst) == &items[i].link, "Expected links to come out back to front.\n");
+    }
+    cr_assert(illist__get_length(lst) == 0, "Expected the list to be empty after popping all links.\n");
+    cr_assert(illist__first(lst) == NULL && illist__last(lst) == NULL, "Expected no first or last link.\n");
+}
+
+Test(illist__pop_back, one_item, .init = setup, .fini = teardown) {
+    cr_assert(illist__pop_back(lst) == &items[3].link, "Expected the last link to be returned.\n");
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102]\n");
+}
@@ -0,0 +1,56 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__pop_front, one_item, .init = setup, .fini = teardown) {
+    llist__Link * link = illist__pop_front(lst);
+    cr_assert(LLIST_CONTAINER_OF(link, Item, link) == &items[0], "Expected the first item to be returned.\n");
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n");
+}
+
+Test(illist__pop_front, all_items_then_prepend, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 4; i++) {
+        illist__pop_front(lst);
+    }
+    illist__prepend(lst, &items[3].link);
+    illist__prepend(lst, &items[2].link);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[102, 103]\n");
+}
@@ -0,0 +1,72 @@
+#include "llist/illist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    llist__Link link;
+} Item;
+
+static Item items[] = { { .id = 100 }, { .id = 101 }, { .id = 102 }, { .id = 103 } };
+
+static IntrusiveList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = illist__create();
+    for (size_t i = 0; i < 4; i++) {
+        illist__append(lst, &items[i].link);
+    }
+}
+
+static void teardown (void) {
+    illist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    Item * item = LLIST_CONTAINER_OF(elem, Item, link);
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", item->id);
+    } else {
+        fprintf(fd, "%d", item->id);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(illist__unlink, first_and_last, .init = setup, .fini = teardown) {
+    illist__unlink(lst, &items[0].link);
+    illist__unlink(lst, &items[3].link);
+    illist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102]\n");
+    cr_assert(illist__first(lst) == &items[1].link, "Expected the first link to be updated.\n");
+    cr_assert(illist__last(lst) == &items[2].link, "Expected the last link to be updated.\n");
+}
+
+typedef struct {
+    int id;
+    llist__Link by_arrival;
+    llist__Link by_priority;
+} Task;
+
+Test(illist__unlink, on_two_lists) {
+    IntrusiveList * arrivals = illist__create();
+    IntrusiveList * priorities = illist__create();
+    Task tasks[] = { { .id = 1 }, { .id = 2 }, { .id = 3 } };
+    for (size_t i = 0; i < 3; i++) {
+        illist__append(arrivals, &tasks[i].by_arrival);
+        illist__prepend(priorities, &tasks[i].by_priority);
+    }
+    illist__unlink(arrivals, &tasks[1].by_arrival);
+    cr_assert(illist__get_length(arrivals) == 2, "Expected one link fewer on the first list.\n");
+    cr_assert(illist__get_length(priorities) == 3, "Expected the second list to be unaffected.\n");
+    Task * second = LLIST_CONTAINER_OF(illist__get(1, arrivals), Task, by_arrival);
+    cr_assert(second->id == 3, "Expected the neighbors to be joined.\n");
+    Task * middle = LLIST_CONTAINER_OF(illist__get(1, priorities), Task, by_priority);
+    cr_assert(middle->id == 2, "Expected the unlinked task to remain on the second list.\n");
+    illist__destroy(&arrivals);
+    illist__destroy(&priorities);
+}
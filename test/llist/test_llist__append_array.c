@@ -0,0 +1,49 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__append_array, into_empty_list, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    void * items[] = { &arr[0], &arr[1], &arr[2], &arr[3] };
+    llist__append_array(lst, items, 4);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
+
+Test(llist__append_array, onto_existing_items, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    void * items[] = { &arr[1], &arr[2] };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append_array(lst, items, 2);
+    llist__append_array(lst, items, 0);
+    llist__append(lst, (void *) &arr[3]);
+    cr_assert(llist__pop_back(lst) == &arr[3], "Expected the last item to be appended after the array.\n");
+    cr_assert(llist__pop_back(lst) == &arr[2], "Expected the array to be linked backwards as well.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101]\n");
+}
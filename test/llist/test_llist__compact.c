@@ -0,0 +1,220 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#define NITEMS 1000
+
+static int items[NITEMS];
+
+static void * expected[NITEMS];
+
+typedef struct {
+    size_t nallocs;
+    size_t nfrees;
+    size_t nbytes;
+    size_t limit;
+} Counts;
+
+static llist__NodePool * pool = NULL;
+
+static LinkedList * lst = NULL;
+
+static void fill_scattered (void) {
+    // insert at pseudo-random positions, such that list order and
+    // allocation order disagree
+    for (size_t i = 0; i < NITEMS; i++) {
+        items[i] = (int) i;
+        llist__insert((i * 7919) % (i + 1), (void *) &items[i], lst);
+    }
+    for (size_t i = 0; i < NITEMS; i++) {
+        expected[i] = llist__get(i, lst);
+    }
+}
+
+static void setup_pool (void) {
+    pool = llist__pool_create(64);
+    lst = llist__create_with_pool(pool);
+    fill_scattered();
+}
+
+static void teardown_pool (void) {
+    llist__destroy(&lst);
+    llist__pool_destroy(&pool);
+}
+
+static void setup_malloc (void) {
+    lst = llist__create();
+    fill_scattered();
+}
+
+static void teardown_malloc (void) {
+    llist__destroy(&lst);
+}
+
+static void * counting_alloc (size_t size, void * ctx) {
+    Counts * counts = ctx;
+    if (counts->limit > 0 && size > counts->limit) return NULL;
+    counts->nallocs++;
+    counts->nbytes += size;
+    return malloc(size);
+}
+
+static void counting_free (void * p, size_t size, void * ctx) {
+    Counts * counts = ctx;
+    counts->nfrees++;
+    counts->nbytes -= size;
+    free(p);
+}
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void assert_in_order (void) {
+    cr_assert(llist__get_length(lst) == NITEMS, "Expected the number of items to remain the same.\n");
+    llist__Iter it = llist__iter_begin(lst);
+    size_t i = 0;
+    while (llist__iter_next(&it)) {
+        cr_assert(llist__iter_get(&it) == expected[i], "Expected item %zu to remain at its position.\n", i);
+        i++;
+    }
+}
+
+Test(llist__compact, pool, .init = setup_pool, .fini = teardown_pool) {
+    llist__Locality locality = llist__compact(lst);
+    cr_assert(locality.before < 0.5, "Expected the nodes to start out scattered.\n");
+    cr_assert(locality.after == 1.0, "Expected the nodes to end up adjacent.\n");
+    cr_assert(llist__locality(lst) == 1.0, "Expected the reported locality to match.\n");
+    assert_in_order();
+}
+
+Test(llist__compact, malloc, .init = setup_malloc, .fini = teardown_malloc) {
+    llist__Locality locality = llist__compact(lst);
+    cr_assert(locality.after == 1.0, "Expected the nodes to end up adjacent.\n");
+    assert_in_order();
+    llist__pop_front(lst);
+    llist__append(lst, (void *) &items[0]);
+    cr_assert(llist__get(NITEMS - 1, lst) == &items[0], "Expected the list to remain usable.\n");
+}
+
+Test(llist__compact, already_compact, .init = setup_pool, .fini = teardown_pool) {
+    llist__compact(lst);
+    llist__Locality locality = llist__compact(lst);
+    cr_assert(locality.before == 1.0 && locality.after == 1.0, "Expected a compact list to stay as is.\n");
+    assert_in_order();
+}
+
+Test(llist__compact, keyed_and_indexed, .init = setup_pool, .fini = teardown_pool) {
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    llist__set_indexed(lst, true);
+    llist__compact(lst);
+    for (size_t i = 0; i < NITEMS; i += 97) {
+        cr_assert(llist__get(i, lst) == expected[i], "Expected the index to find item %zu.\n", i);
+        cr_assert(llist__find(lst, &items[i]) == &items[i], "Expected the keys to find item %zu.\n", i);
+    }
+    cr_assert(llist__delete_key(lst, expected[500]) == expected[500], "Expected the item to be deleted by key.\n");
+    cr_assert(llist__get(500, lst) == expected[501], "Expected the next item to take its place.\n");
+}
+
+Test(llist__compact, empty) {
+    LinkedList * empty = llist__create();
+    llist__Locality locality = llist__compact(empty);
+    cr_assert(locality.before == 1.0 && locality.after == 1.0, "Expected an empty list to count as compact.\n");
+    llist__destroy(&empty);
+}
+
+Test(llist__compact, releases_old_nodes) {
+    Counts counts = { .nallocs = 0 };
+    llist__Allocator allocator = { .alloc = counting_alloc, .free = counting_free, .ctx = &counts };
+    lst = llist__try_create(&allocator);
+    fill_scattered();
+    llist__reserve(lst, NITEMS + 10);
+    size_t nallocs = counts.nallocs;
+    size_t nfrees = counts.nfrees;
+    llist__compact(lst);
+    cr_assert(counts.nallocs == nallocs + 2, "Expected the nodes to move into a single registered block.\n");
+    cr_assert(counts.nfrees == nfrees + NITEMS + 10, "Expected the old and spare nodes to be freed.\n");
+    llist__pop_front(lst);
+    llist__append(lst, expected[0]);
+    cr_assert(counts.nallocs == nallocs + 2, "Expected deleted nodes to be reused from the block.\n");
+    nallocs = counts.nallocs;
+    nfrees = counts.nfrees;
+    llist__compact(lst);
+    cr_assert(counts.nallocs == nallocs + 1 && counts.nfrees == nfrees + 1,
+              "Expected the new block to replace the old one.\n");
+    llist__destroy(&lst);
+    cr_assert(counts.nallocs == counts.nfrees && counts.nbytes == 0, "Expected all memory to be returned.\n");
+}
+
+Test(llist__compact, shares_block, .init = setup_malloc) {
+    llist__compact(lst);
+    LinkedList * other = llist__create();
+    llist__append(other, NULL);
+    LinkedList * tail = llist__split(lst, NITEMS / 2);
+    llist__splice(other, 1, tail);
+    llist__destroy(&tail);
+    llist__destroy(&lst);
+    cr_assert(llist__get_length(other) == NITEMS - NITEMS / 2 + 1, "Expected the nodes to stay in the other list.\n");
+    for (size_t i = NITEMS / 2; i < NITEMS; i++) {
+        cr_assert(llist__get(i - NITEMS / 2 + 1, other) == expected[i], "Expected item %zu to remain intact.\n", i);
+    }
+    llist__destroy(&other);
+}
+
+Test(llist__compact, pool_shared, .init = setup_pool, .fini = teardown_pool) {
+    // nodes released to a compacted list's block must stay out of the pool
+    LinkedList * other = llist__create_with_pool(pool);
+    llist__compact(lst);
+    llist__compact(lst);
+    for (size_t i = 0; i < NITEMS / 2; i++) {
+        llist__pop_back(lst);
+        llist__append(other, (void *) &items[i]);
+    }
+    cr_assert(llist__locality(lst) == 1.0, "Expected the remaining nodes to stay adjacent.\n");
+    llist__destroy(&other);
+}
+
+Test(llist__compact, out_of_memory) {
+    // blocks are larger than anything else the list allocates
+    Counts counts = { .nallocs = 0 };
+    llist__Allocator allocator = { .alloc = counting_alloc, .free = counting_free, .ctx = &counts };
+    lst = llist__try_create(&allocator);
+    fill_scattered();
+    counts.limit = 1024;
+    errno = 0;
+    llist__Locality locality = llist__compact(lst);
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+    cr_assert(locality.after == locality.before, "Expected the locality to stay the same.\n");
+    cr_assert(llist__locality(lst) == locality.before, "Expected the nodes to stay where they were.\n");
+    assert_in_order();
+    llist__destroy(&lst);
+    cr_assert(counts.nallocs == counts.nfrees && counts.nbytes == 0, "Expected all memory to be returned.\n");
+}
+
+Test(llist__compact, bounded_blocks) {
+    // a steady cycle of compactions and splices doesn't accumulate blocks
+    Counts counts = { .nallocs = 0 };
+    llist__Allocator allocator = { .alloc = counting_alloc, .free = counting_free, .ctx = &counts };
+    lst = llist__try_create(&allocator);
+    fill_scattered();
+    size_t nbytes = 0;
+    for (size_t round = 0; round < 50; round++) {
+        LinkedList * tail = llist__split(lst, NITEMS / 2);
+        llist__compact(tail);
+        llist__splice(lst, 0, tail);
+        llist__destroy(&tail);
+        llist__compact(lst);
+        if (round == 0) {
+            nbytes = counts.nbytes;
+        }
+        cr_assert(counts.nbytes == nbytes, "Expected memory use to stay the same in round %zu.\n", round);
+    }
+    llist__destroy(&lst);
+    cr_assert(counts.nallocs == counts.nfrees && counts.nbytes == 0, "Expected all memory to be returned.\n");
+}
@@ -0,0 +1,41 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static LinkedList * lst = NULL;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void setup (void) {
+    lst = llist__create();
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+Test(llist__contains, present_and_absent, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    int key = 101;
+    cr_assert(llist__contains(lst, &key), "Expected the list to contain 101.\n");
+    key = 99;
+    cr_assert(!llist__contains(lst, &key), "Expected the list not to contain 99.\n");
+}
+
+Test(llist__contains, after_append_array, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102 };
+    void * items[] = { &arr[0], &arr[1], &arr[2] };
+    llist__append_array(lst, items, 3);
+    for (size_t i = 0; i < 3; i++) {
+        cr_assert(llist__contains(lst, &arr[i]), "Expected appended item %zu to be keyed.\n", i);
+    }
+}
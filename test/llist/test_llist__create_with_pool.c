@@ -0,0 +1,75 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static llist__NodePool * pool = NULL;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    pool = llist__pool_create(2);
+    lst = llist__create_with_pool(pool);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    llist__pool_destroy(&pool);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool filter (void * p) {
+    return *((int *) p) % 2 == 0;
+}
+
+Test(llist__create_with_pool, more_items_than_a_slab, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103, 104 };
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[3]);
+    llist__prepend(lst, (void *) &arr[0]);
+    llist__insert(2, (void *) &arr[2], lst);
+    llist__append(lst, (void *) &arr[4]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104]\n");
+}
+
+Test(llist__create_with_pool, reuses_freed_nodes, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__delete(true, lst, filter);
+    llist__append(lst, (void *) &arr[3]);
+    llist__prepend(lst, (void *) &arr[0]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 103]\n");
+}
+
+Test(llist__create_with_pool, shared_between_lists, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    LinkedList * other = llist__create_with_pool(pool);
+    llist__append(other, (void *) &arr[0]);
+    llist__append(other, (void *) &arr[1]);
+    llist__append(other, (void *) &arr[2]);
+    llist__destroy(&other);
+    llist__append(lst, (void *) &arr[3]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[0]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[103, 102, 101, 100]\n");
+}
@@ -61,3 +61,53 @@ Test(llist__delete, local, .init = setup, .fini = teardown) {
     cr_assert_stdout_eq_str(
         "[{.marked: false, .data: 101}, {.marked: false, .data: 102}, {.marked: false, .data: 103}]\n");
 }
+
+Test(llist__delete, last_then_append, .init = setup, .fini = teardown) {
+    MyStruct extra = { .marked = true, .data = 105 };
+    llist__delete(false, lst, filter);
+    llist__delete(false, lst, filter);
+    llist__append(lst, (void *) &extra);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str(
+        "[{.marked: false, .data: 101}, {.marked: false, .data: 103}, {.marked: true, .data: 105}]\n");
+}
+
+#ifdef LLIST_STATS
+
+static bool is_never (void *) {
+    return false;
+}
+
+static bool is_any (void *) {
+    return true;
+}
+
+static uint64_t get_nodes (LinkedList * indexed, size_t pos) {
+    llist__Stats before;
+    llist__Stats after;
+    llist__stats(indexed, &before);
+    llist__get(pos, indexed);
+    llist__stats(indexed, &after);
+    return after.ops[LLIST_STATS_GET].nodes - before.ops[LLIST_STATS_GET].nodes;
+}
+
+Test(llist__delete, keeps_index) {
+    int items[1000];
+    LinkedList * indexed = llist__create();
+    llist__set_indexed(indexed, true);
+    for (size_t i = 0; i < 1000; i++) {
+        items[i] = (int) i;
+        llist__append(indexed, (void *) &items[i]);
+    }
+    get_nodes(indexed, 500);
+    llist__delete(true, indexed, is_never);
+    cr_assert(get_nodes(indexed, 500) < 100, "Expected a delete without matches to keep the index.\n");
+    llist__delete(false, indexed, is_any);
+    cr_assert(get_nodes(indexed, 500) < 100, "Expected deleting the first item to keep the index.\n");
+    cr_assert(llist__get(0, indexed) == &items[1], "Expected the first item to be deleted.\n");
+    cr_assert(llist__get(500, indexed) == &items[501], "Expected the index to account for the deletion.\n");
+    llist__destroy(&indexed);
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103, 104, 105 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    for (size_t i = 0; i < 6; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool is_multiple_of (void * p, void * ctx) {
+    return *((int *) p) % *((int *) ctx) == 0;
+}
+
+Test(llist__delete_ctx, unlimited, .init = setup, .fini = teardown) {
+    int divisor = 3;
+    size_t n = llist__delete_ctx(lst, is_multiple_of, &divisor, SIZE_MAX, NULL);
+    cr_assert(n == 2, "Expected 2 items to be deleted but deleted %zu.\n", n);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 103, 104]\n");
+}
+
+Test(llist__delete_ctx, limited, .init = setup, .fini = teardown) {
+    int divisor = 2;
+    size_t n = llist__delete_ctx(lst, is_multiple_of, &divisor, 2, NULL);
+    cr_assert(n == 2, "Expected 2 items to be deleted but deleted %zu.\n", n);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 103, 104, 105]\n");
+}
+
+Test(llist__delete_ctx, hands_back_removed, .init = setup, .fini = teardown) {
+    int divisor = 2;
+    LinkedList * removed = llist__create();
+    llist__append(removed, (void *) &arr[5]);
+    size_t n = llist__delete_ctx(lst, is_multiple_of, &divisor, SIZE_MAX, removed);
+    cr_assert(n == 3, "Expected 3 items to be deleted but deleted %zu.\n", n);
+    llist__print(lst, &printers, stdout);
+    llist__print(removed, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 103, 105]\n[105, 100, 102, 104]\n");
+    llist__destroy(&removed);
+}
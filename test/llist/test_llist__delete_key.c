@@ -0,0 +1,87 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__delete_key, middle, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102 };
+    for (size_t i = 0; i < 3; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    int key = 101;
+    cr_assert(llist__delete_key(lst, &key) == &arr[1], "Expected the deleted item to be returned.\n");
+    cr_assert(!llist__contains(lst, &key), "Expected the deleted key to be gone.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102]\n");
+}
+
+Test(llist__delete_key, absent, .init = setup, .fini = teardown) {
+    int arr[] = { 100 };
+    llist__append(lst, (void *) &arr[0]);
+    int key = 101;
+    cr_assert(llist__delete_key(lst, &key) == NULL, "Expected nothing to be deleted.\n");
+    cr_assert(llist__get_length(lst) == 1, "Expected the list to keep its item.\n");
+}
+
+Test(llist__delete_key, all_in_turn, .init = setup, .fini = teardown) {
+    // deleting in insertion order exercises the backward shift
+    int arr[300];
+    for (int i = 0; i < 300; i++) {
+        arr[i] = i * 16;
+        llist__append(lst, (void *) &arr[i]);
+    }
+    for (int i = 0; i < 300; i++) {
+        cr_assert(llist__delete_key(lst, &arr[i]) == &arr[i], "Expected to delete item %d.\n", i);
+        for (int j = i + 1; j < 300; j += 37) {
+            cr_assert(llist__contains(lst, &arr[j]), "Expected item %d to survive.\n", j);
+        }
+    }
+    cr_assert(llist__get_length(lst) == 0, "Expected the list to be empty.\n");
+}
+
+Test(llist__delete_key, indexed, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    llist__set_indexed(lst, true);
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__delete_key(lst, &arr[1]);
+    cr_assert(llist__get(1, lst) == &arr[2], "Expected the index to follow the deletion.\n");
+    llist__insert(1, (void *) &arr[1], lst);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
@@ -0,0 +1,181 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <math.h>
+#include <stddef.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int id;
+    float price;
+} Order;
+
+#define NORDERS 200
+
+static Order orders[NORDERS];
+
+static int arr[] = { 100, 101, 102, 103, 104, 105 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    for (size_t i = 0; i < 6; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+}
+
+static void setup_orders (void) {
+    lst = llist__create();
+    for (size_t i = 0; i < NORDERS; i++) {
+        orders[i] = (Order) { .id = (int) i, .price = (float) i / 2.0f };
+        llist__append(lst, (void *) &orders[i]);
+    }
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static const void * order_id (const void * item, void *) {
+    return &((const Order *) item)->id;
+}
+
+static void assert_remaining (bool (*kept)(const Order *)) {
+    llist__Iter it = llist__iter_begin(lst);
+    size_t n = 0;
+    for (size_t i = 0; i < NORDERS; i++) {
+        if (!kept(&orders[i])) continue;
+        cr_assert(llist__iter_next(&it), "Expected order %zu to remain.\n", i);
+        cr_assert(llist__iter_get(&it) == &orders[i], "Expected order %zu to remain in place.\n", i);
+        n++;
+    }
+    cr_assert(!llist__iter_next(&it), "Expected no other orders to remain.\n");
+    cr_assert(llist__get_length(lst) == n, "Expected %zu orders to remain.\n", n);
+}
+
+static bool price_at_least_30 (const Order * order) {
+    return order->price >= 30.0f;
+}
+
+static bool id_outside_50_to_149 (const Order * order) {
+    return order->id < 50 || order->id > 149;
+}
+
+Test(llist__delete_where, int_gt, .init = setup, .fini = teardown) {
+    llist__Where where = { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_GT, .value = { .i = 102 } };
+    size_t n = llist__delete_where(lst, &where);
+    cr_assert(n == 3, "Expected 3 items to be deleted but deleted %zu.\n", n);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102]\n");
+}
+
+Test(llist__delete_where, int_lt, .init = setup, .fini = teardown) {
+    llist__Where where = { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_LT, .value = { .i = 102 } };
+    llist__delete_where(lst, &where);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[102, 103, 104, 105]\n");
+}
+
+Test(llist__delete_where, int_eq, .init = setup, .fini = teardown) {
+    llist__Where where = { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_EQ, .value = { .i = 105 } };
+    llist__delete_where(lst, &where);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104]\n");
+}
+
+Test(llist__delete_where, int_in, .init = setup, .fini = teardown) {
+    llist__Scalar set[] = { { .i = 100 }, { .i = 103 }, { .i = 999 } };
+    llist__Where where = { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_IN, .set = set, .nset = 3 };
+    size_t n = llist__delete_where(lst, &where);
+    cr_assert(n == 2, "Expected 2 items to be deleted but deleted %zu.\n", n);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 104, 105]\n");
+}
+
+Test(llist__delete_where, int_range_across_batches, .init = setup_orders, .fini = teardown) {
+    llist__Where where = {
+        .type = LLIST_FIELD_INT,
+        .offset = offsetof(Order, id),
+        .op = LLIST_WHERE_RANGE,
+        .value = { .i = 50 },
+        .upper = { .i = 149 },
+    };
+    size_t n = llist__delete_where(lst, &where);
+    cr_assert(n == 100, "Expected 100 items to be deleted but deleted %zu.\n", n);
+    assert_remaining(id_outside_50_to_149);
+}
+
+Test(llist__delete_where, float_lt_at_offset, .init = setup_orders, .fini = teardown) {
+    llist__Where where = {
+        .type = LLIST_FIELD_FLOAT,
+        .offset = offsetof(Order, price),
+        .op = LLIST_WHERE_LT,
+        .value = { .f = 30.0f },
+    };
+    size_t n = llist__delete_where(lst, &where);
+    cr_assert(n == 60, "Expected 60 items to be deleted but deleted %zu.\n", n);
+    assert_remaining(price_at_least_30);
+}
+
+Test(llist__delete_where, float_nan_matches_nothing, .init = setup_orders, .fini = teardown) {
+    orders[7].price = NAN;
+    llist__Scalar set[] = { { .f = NAN } };
+    llist__Where where = { .type = LLIST_FIELD_FLOAT, .offset = offsetof(Order, price), .op = LLIST_WHERE_IN };
+    where.set = set;
+    where.nset = 1;
+    cr_assert(llist__delete_where(lst, &where) == 0, "Expected NaN not to equal NaN.\n");
+    where.op = LLIST_WHERE_RANGE;
+    where.value.f = -INFINITY;
+    where.upper.f = INFINITY;
+    cr_assert(llist__delete_where(lst, &where) == NORDERS - 1, "Expected all but the NaN to be in range.\n");
+    cr_assert(llist__get(0, lst) == &orders[7], "Expected the NaN to remain.\n");
+}
+
+Test(llist__delete_where, keyed, .init = setup_orders, .fini = teardown) {
+    llist__KeyOps ops = { .key = order_id, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    llist__Where where = {
+        .type = LLIST_FIELD_FLOAT,
+        .offset = offsetof(Order, price),
+        .op = LLIST_WHERE_GT,
+        .value = { .f = 90.0f },
+    };
+    size_t n = llist__delete_where(lst, &where);
+    cr_assert(n == 19, "Expected 19 items to be deleted but deleted %zu.\n", n);
+    int id = 180;
+    cr_assert(llist__find(lst, &id) == &orders[180], "Expected order 180 to be found by key.\n");
+    id = 181;
+    cr_assert(llist__find(lst, &id) == NULL, "Expected order 181 to be gone.\n");
+}
+
+Test(llist__delete_where, empty) {
+    LinkedList * empty = llist__create();
+    llist__Where where = { .type = LLIST_FIELD_INT, .op = LLIST_WHERE_EQ };
+    cr_assert(llist__delete_where(empty, &where) == 0, "Expected nothing to be deleted.\n");
+    llist__destroy(&empty);
+}
@@ -0,0 +1,68 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103, 104, 105 };
+
+static LinkedList * dst = NULL;
+
+static LinkedList * src = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    dst = llist__create();
+    src = llist__create();
+    llist__append(dst, (void *) &arr[0]);
+    llist__append(dst, (void *) &arr[1]);
+    llist__append(dst, (void *) &arr[2]);
+    llist__append(src, (void *) &arr[3]);
+    llist__append(src, (void *) &arr[4]);
+    llist__append(src, (void *) &arr[5]);
+}
+
+static void teardown (void) {
+    llist__destroy(&dst);
+    llist__destroy(&src);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__extend, nonempty, .init = setup, .fini = teardown) {
+    llist__extend(dst, src);
+    llist__print(dst, &printers, stdout);
+    llist__print(src, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104, 105]\n[]\n");
+    cr_assert(llist__pop_back(dst) == &arr[5], "Expected the last item of src to end up last.\n");
+}
+
+Test(llist__extend, into_empty, .init = setup, .fini = teardown) {
+    LinkedList * empty = llist__create();
+    llist__extend(empty, src);
+    llist__extend(src, empty);
+    llist__print(src, &printers, stdout);
+    llist__print(empty, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[103, 104, 105]\n[]\n");
+    llist__destroy(&empty);
+}
+
+Test(llist__extend, from_empty, .init = setup, .fini = teardown) {
+    LinkedList * empty = llist__create();
+    llist__extend(dst, empty);
+    llist__append(dst, (void *) &arr[3]);
+    llist__print(dst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+    llist__destroy(&empty);
+}
@@ -0,0 +1,63 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static LinkedList * lst = NULL;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void setup (void) {
+    lst = llist__create();
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+Test(llist__find, empty_list, .init = setup, .fini = teardown) {
+    int key = 100;
+    cr_assert(llist__find(lst, &key) == NULL, "Expected not to find anything in an empty list.\n");
+}
+
+Test(llist__find, by_equal_key, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102 };
+    for (size_t i = 0; i < 3; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    int key = 102;
+    cr_assert(llist__find(lst, &key) == &arr[2], "Expected to find the item whose key equals the given key.\n");
+    key = 103;
+    cr_assert(llist__find(lst, &key) == NULL, "Expected not to find a key that isn't there.\n");
+}
+
+Test(llist__find, colliding_hashes, .init = setup, .fini = teardown) {
+    // keys that are multiples of a large power of two share their low bits
+    int arr[64];
+    for (int i = 0; i < 64; i++) {
+        arr[i] = i << 20;
+        llist__append(lst, (void *) &arr[i]);
+    }
+    for (int i = 0; i < 64; i++) {
+        int key = i << 20;
+        cr_assert(llist__find(lst, &key) == &arr[i], "Expected to find key %d.\n", key);
+    }
+}
+
+Test(llist__find, after_removal, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102 };
+    for (size_t i = 0; i < 3; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__pop_front(lst);
+    llist__pop_back(lst);
+    cr_assert(llist__find(lst, &arr[0]) == NULL, "Expected popped items not to be found.\n");
+    cr_assert(llist__find(lst, &arr[2]) == NULL, "Expected popped items not to be found.\n");
+    cr_assert(llist__find(lst, &arr[1]) == &arr[1], "Expected the remaining item to be found.\n");
+}
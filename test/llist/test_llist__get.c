@@ -0,0 +1,34 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static int arr[] = { 100, 101, 102, 103, 104 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    lst = llist__create();
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[3]);
+    llist__append(lst, (void *) &arr[4]);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+Test(llist__get, every_position, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 5; i++) {
+        int * actual = llist__get(i, lst);
+        cr_assert(actual == &arr[i], "Expected item %zu to be %d but was %d.\n", i, arr[i], *actual);
+    }
+}
+
+Test(llist__get, every_position_indexed, .init = setup, .fini = teardown) {
+    llist__set_indexed(lst, true);
+    for (size_t i = 0; i < 5; i++) {
+        int * actual = llist__get(i, lst);
+        cr_assert(actual == &arr[i], "Expected item %zu to be %d but was %d.\n", i, arr[i], *actual);
+    }
+}
@@ -0,0 +1,57 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static int by_value (const void * a, const void * b, void *) {
+    int x = *((const int *) a);
+    int y = *((const int *) b);
+    return (x > y) - (x < y);
+}
+
+Test(llist__insert_sorted, out_of_order, .init = setup, .fini = teardown) {
+    int arr[] = { 102, 100, 104, 101, 103, 100 };
+    size_t expected[] = { 0, 0, 2, 1, 3, 1 };
+    for (size_t i = 0; i < 6; i++) {
+        size_t pos = llist__insert_sorted(lst, (void *) &arr[i], by_value, NULL);
+        cr_assert(pos == expected[i], "Expected item %zu to be inserted at %zu but was at %zu.\n", i, expected[i], pos);
+    }
+    cr_assert(llist__get(1, lst) == &arr[5], "Expected equal items to keep their insertion order.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 100, 101, 102, 103, 104]\n");
+}
+
+Test(llist__insert_sorted, indexed, .init = setup, .fini = teardown) {
+    int arr[] = { 102, 100, 104, 101, 103 };
+    llist__set_indexed(lst, true);
+    for (size_t i = 0; i < 5; i++) {
+        llist__insert_sorted(lst, (void *) &arr[i], by_value, NULL);
+    }
+    cr_assert(llist__get(3, lst) == &arr[4], "Expected the index to reflect the sorted insertions.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104]\n");
+}
@@ -0,0 +1,56 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__iter_insert_after, before_first, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101 };
+    llist__append(lst, (void *) &arr[1]);
+    llist__Iter it = llist__iter_begin(lst);
+    llist__iter_insert_after(&it, (void *) &arr[0]);
+    cr_assert(llist__iter_next(&it), "Expected the original first item to follow.\n");
+    cr_assert(llist__iter_get(&it) == &arr[1], "Expected the original first item to follow.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101]\n");
+}
+
+Test(llist__iter_insert_after, after_every_item, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 102, 104 };
+    int odd[] = { 101, 103, 105 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__Iter it = llist__iter_begin(lst);
+    size_t i = 0;
+    while (llist__iter_next(&it)) {
+        llist__iter_insert_after(&it, (void *) &odd[i++]);
+    }
+    cr_assert(llist__get_length(lst) == 6, "Expected 6 items.\n");
+    llist__append(lst, (void *) &arr[0]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104, 105, 100]\n");
+}
@@ -0,0 +1,33 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+Test(llist__iter_next, empty, .init = setup, .fini = teardown) {
+    llist__Iter it = llist__iter_begin(lst);
+    cr_assert(!llist__iter_next(&it), "Expected no items in an empty list.\n");
+    cr_assert(!llist__iter_next(&it), "Expected the cursor to stay exhausted.\n");
+}
+
+Test(llist__iter_next, four_items, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[3]);
+    llist__Iter it = llist__iter_begin(lst);
+    size_t i = 0;
+    while (llist__iter_next(&it)) {
+        cr_assert(llist__iter_get(&it) == &arr[i], "Expected item %zu to be visited in order.\n", i);
+        i++;
+    }
+    cr_assert(i == 4, "Expected 4 items to be visited but visited %zu.\n", i);
+}
@@ -0,0 +1,68 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103, 104 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[3]);
+    llist__append(lst, (void *) &arr[4]);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__iter_remove_here, even_items, .init = setup, .fini = teardown) {
+    llist__Iter it = llist__iter_begin(lst);
+    while (llist__iter_next(&it)) {
+        int * p = llist__iter_get(&it);
+        if (*p % 2 == 0) {
+            cr_assert(llist__iter_remove_here(&it) == p, "Expected the removed item to be returned.\n");
+        }
+    }
+    llist__append(lst, (void *) &arr[4]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 103, 104]\n");
+}
+
+Test(llist__iter_remove_here, all_items, .init = setup, .fini = teardown) {
+    llist__Iter it = llist__iter_begin(lst);
+    while (llist__iter_next(&it)) {
+        llist__iter_remove_here(&it);
+    }
+    cr_assert(llist__get_length(lst) == 0, "Expected the list to be empty.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[]\n");
+}
+
+Test(llist__iter_remove_here, indexed, .init = setup, .fini = teardown) {
+    llist__set_indexed(lst, true);
+    llist__Iter it = llist__iter_begin(lst);
+    llist__iter_next(&it);
+    llist__iter_next(&it);
+    llist__iter_remove_here(&it);
+    cr_assert(llist__get(1, lst) == &arr[2], "Expected the index to reflect the removal.\n");
+    cr_assert(llist__get(3, lst) == &arr[4], "Expected the index to reflect the removal.\n");
+}
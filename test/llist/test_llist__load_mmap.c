@@ -0,0 +1,139 @@
+#define _POSIX_C_SOURCE 200809L
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static char path[] = "/tmp/test_llist__load_mmap_XXXXXX";
+
+static LinkedList * lst = NULL;
+
+static size_t int_size (const void *, void *) {
+    return sizeof(int);
+}
+
+static void setup (void) {
+    cr_redirect_stdout();
+    LinkedList * original = llist__create();
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(original, (void *) &arr[i]);
+    }
+    int fd = mkstemp(path);
+    cr_assert(fd >= 0, "Expected a temporary file.\n");
+    llist__Codec codec = { .size = int_size };
+    cr_assert(llist__save(original, fd, &codec), "Expected saving to succeed.\n");
+    close(fd);
+    llist__destroy(&original);
+    lst = llist__load_mmap(path);
+    cr_assert(lst != NULL, "Expected loading to succeed.\n");
+}
+
+static void teardown (void) {
+    if (lst != NULL) {
+        llist__destroy(&lst);
+    }
+    unlink(path);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool is_odd (void * p) {
+    return (*((int *) p) & 1) == 1;
+}
+
+Test(llist__load_mmap, contents, .init = setup, .fini = teardown) {
+    cr_assert(llist__get_length(lst) == 4, "Expected 4 items.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
+
+Test(llist__load_mmap, payloads_are_not_copies, .init = setup, .fini = teardown) {
+    int * first = llist__get(0, lst);
+    cr_assert(first != &arr[0], "Expected payloads to live in the mapping.\n");
+    *first = 7;
+    cr_assert(arr[0] == 100, "Expected the original to be unaffected.\n");
+    cr_assert(*((int *) llist__get(0, lst)) == 7, "Expected the payload to be writable.\n");
+}
+
+Test(llist__load_mmap, edits, .init = setup, .fini = teardown) {
+    static int extra[] = { 98, 99, 104 };
+    llist__prepend(lst, (void *) &extra[1]);
+    llist__insert(0, (void *) &extra[0], lst);
+    llist__delete(true, lst, is_odd);
+    llist__append(lst, (void *) &extra[2]);
+    llist__pop_back(lst);
+    llist__append(lst, (void *) &extra[2]);
+    LinkedList * tail = llist__split(lst, 2);
+    llist__print(lst, &printers, stdout);
+    llist__print(tail, &printers, stdout);
+    llist__destroy(&lst);
+    llist__print(tail, &printers, stdout);
+    llist__destroy(&tail);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[98, 100]\n[102, 104]\n[102, 104]\n");
+}
+
+Test(llist__load_mmap, empty_list) {
+    LinkedList * empty = llist__create();
+    int fd = mkstemp(path);
+    cr_assert(llist__save(empty, fd, NULL), "Expected saving to succeed.\n");
+    close(fd);
+    llist__destroy(&empty);
+    LinkedList * loaded = llist__load_mmap(path);
+    unlink(path);
+    cr_assert(loaded != NULL && llist__get_length(loaded) == 0, "Expected an empty list back.\n");
+    llist__append(loaded, (void *) &arr[0]);
+    cr_assert(llist__get(0, loaded) == &arr[0], "Expected the loaded list to grow as usual.\n");
+    llist__destroy(&loaded);
+}
+
+Test(llist__load_mmap, missing_file) {
+    errno = 0;
+    cr_assert(llist__load_mmap("/nonexistent/snapshot") == NULL, "Expected loading to fail.\n");
+    cr_assert(errno == ENOENT, "Expected errno to say why.\n");
+}
+
+Test(llist__load_mmap, not_a_snapshot) {
+    int fd = mkstemp(path);
+    char junk[256];
+    memset(junk, 'x', sizeof(junk));
+    cr_assert(write(fd, junk, sizeof(junk)) == sizeof(junk), "Expected to write junk.\n");
+    close(fd);
+    errno = 0;
+    cr_assert(llist__load_mmap(path) == NULL, "Expected loading to fail.\n");
+    cr_assert(errno == EINVAL, "Expected errno to say why.\n");
+    unlink(path);
+}
+
+Test(llist__load_mmap, corrupt_record, .init = setup, .fini = teardown) {
+    // point the second record's next at itself
+    llist__destroy(&lst);
+    FILE * fp = fopen(path, "r+b");
+    uint64_t nodes_offset = 0;
+    fseek(fp, 32, SEEK_SET);
+    cr_assert(fread(&nodes_offset, sizeof(nodes_offset), 1, fp) == 1, "Expected to read the header.\n");
+    uint64_t self = nodes_offset + 24;
+    fseek(fp, (long) (nodes_offset + 24 + 8), SEEK_SET);
+    fwrite(&self, sizeof(self), 1, fp);
+    fclose(fp);
+    errno = 0;
+    cr_assert(llist__load_mmap(path) == NULL, "Expected loading to fail.\n");
+    cr_assert(errno == EINVAL, "Expected errno to say why.\n");
+}
@@ -0,0 +1,38 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static int item = 0;
+
+static llist__NodePool * pool = NULL;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    pool = llist__pool_create(64);
+    lst = llist__create_with_pool(pool);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    llist__pool_destroy(&pool);
+}
+
+Test(llist__locality, fewer_than_two_items, .init = setup, .fini = teardown) {
+    cr_assert(llist__locality(lst) == 1.0, "Expected an empty list to count as compact.\n");
+    llist__append(lst, (void *) &item);
+    cr_assert(llist__locality(lst) == 1.0, "Expected a single item to count as compact.\n");
+}
+
+Test(llist__locality, appended, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 10; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    cr_assert(llist__locality(lst) == 1.0, "Expected appended nodes from one slab to be adjacent.\n");
+}
+
+Test(llist__locality, prepended, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 10; i++) {
+        llist__prepend(lst, (void *) &item);
+    }
+    cr_assert(llist__locality(lst) == 0.0, "Expected each successor to come earlier in memory.\n");
+}
@@ -0,0 +1,41 @@
+#include "llist/lru.h"
+#include <criterion/criterion.h>
+
+static int evicted[4];
+
+static size_t nevicted = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void record_eviction (const void * key, void *, void *) {
+    evicted[nevicted++] = *((const int *) key);
+}
+
+Test(llist__lru_destroy, evicts_remaining) {
+    static int keys[] = { 100, 101, 102 };
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__LruCache * cache = llist__lru_create(4, &ops, record_eviction, NULL);
+    for (size_t i = 0; i < 3; i++) {
+        llist__lru_put(cache, &keys[i], NULL);
+    }
+    llist__lru_destroy(&cache);
+    cr_assert(cache == NULL, "Expected the pointer to be reset.\n");
+    cr_assert(nevicted == 3, "Expected 3 evictions but got %zu.\n", nevicted);
+    cr_assert(evicted[0] == 100 && evicted[1] == 101 && evicted[2] == 102,
+              "Expected the entries to be evicted from least to most recently used.\n");
+}
+
+Test(llist__lru_destroy, without_callback) {
+    int key = 100;
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__LruCache * cache = llist__lru_create(1, &ops, NULL, NULL);
+    llist__lru_put(cache, &key, NULL);
+    llist__lru_destroy(&cache);
+    cr_assert(cache == NULL, "Expected the pointer to be reset.\n");
+}
@@ -0,0 +1,47 @@
+#include "llist/lru.h"
+#include <criterion/criterion.h>
+
+static llist__LruCache * cache = NULL;
+
+static int evicted[16];
+
+static size_t nevicted = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void record_eviction (const void * key, void *, void *) {
+    evicted[nevicted++] = *((const int *) key);
+}
+
+static void setup (void) {
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    cache = llist__lru_create(3, &ops, record_eviction, NULL);
+    nevicted = 0;
+}
+
+static void teardown (void) {
+    llist__lru_destroy(&cache);
+}
+
+Test(llist__lru_evict, least_recently_used, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 101, 102 };
+    double value = 0.5;
+    for (size_t i = 0; i < 3; i++) {
+        llist__lru_put(cache, &keys[i], &value);
+    }
+    llist__lru_touch(cache, &keys[0]);
+    cr_assert(llist__lru_evict(cache), "Expected an entry to be evicted.\n");
+    cr_assert(nevicted == 1 && evicted[0] == 101, "Expected 101 to be evicted.\n");
+    cr_assert(llist__lru_get_length(cache) == 2, "Expected 2 entries to remain.\n");
+}
+
+Test(llist__lru_evict, empty, .init = setup, .fini = teardown) {
+    cr_assert(!llist__lru_evict(cache), "Expected nothing to be evicted from an empty cache.\n");
+    cr_assert(nevicted == 0, "Expected the callback not to be called.\n");
+}
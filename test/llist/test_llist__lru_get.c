@@ -0,0 +1,53 @@
+#include "llist/lru.h"
+#include <criterion/criterion.h>
+
+static llist__LruCache * cache = NULL;
+
+static int evicted[16];
+
+static size_t nevicted = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void record_eviction (const void * key, void *, void *) {
+    evicted[nevicted++] = *((const int *) key);
+}
+
+static void setup (void) {
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    cache = llist__lru_create(3, &ops, record_eviction, NULL);
+    nevicted = 0;
+}
+
+static void teardown (void) {
+    llist__lru_destroy(&cache);
+}
+
+Test(llist__lru_get, hit_and_miss, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 101 };
+    double values[] = { 0.5, 1.5 };
+    llist__lru_put(cache, &keys[0], &values[0]);
+    llist__lru_put(cache, &keys[1], &values[1]);
+    int key = 100;
+    cr_assert(llist__lru_get(cache, &key) == &values[0], "Expected a hit for key 100.\n");
+    key = 102;
+    cr_assert(llist__lru_get(cache, &key) == NULL, "Expected a miss for key 102.\n");
+}
+
+Test(llist__lru_get, refreshes_recency, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 101, 102, 103 };
+    double value = 0.5;
+    for (size_t i = 0; i < 3; i++) {
+        llist__lru_put(cache, &keys[i], &value);
+    }
+    llist__lru_get(cache, &keys[0]);
+    llist__lru_put(cache, &keys[3], &value);
+    cr_assert(nevicted == 1 && evicted[0] == 101, "Expected 101 to be evicted instead of 100.\n");
+    cr_assert(llist__lru_get(cache, &keys[0]) == &value, "Expected 100 to survive.\n");
+}
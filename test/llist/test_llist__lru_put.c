@@ -0,0 +1,66 @@
+#include "llist/lru.h"
+#include <criterion/criterion.h>
+
+static llist__LruCache * cache = NULL;
+
+static int evicted[16];
+
+static size_t nevicted = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void record_eviction (const void * key, void *, void *) {
+    evicted[nevicted++] = *((const int *) key);
+}
+
+static void setup (void) {
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    cache = llist__lru_create(3, &ops, record_eviction, NULL);
+    nevicted = 0;
+}
+
+static void teardown (void) {
+    llist__lru_destroy(&cache);
+}
+
+Test(llist__lru_put, evicts_when_full, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 101, 102, 103, 104 };
+    double value = 0.5;
+    for (size_t i = 0; i < 5; i++) {
+        llist__lru_put(cache, &keys[i], &value);
+    }
+    cr_assert(llist__lru_get_length(cache) == 3, "Expected the cache to hold 3 entries.\n");
+    cr_assert(nevicted == 2, "Expected 2 evictions but got %zu.\n", nevicted);
+    cr_assert(evicted[0] == 100 && evicted[1] == 101, "Expected the oldest entries to be evicted first.\n");
+}
+
+Test(llist__lru_put, replaces_value, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 100 };
+    double values[] = { 0.5, 1.5 };
+    llist__lru_put(cache, &keys[0], &values[0]);
+    llist__lru_put(cache, &keys[1], &values[1]);
+    cr_assert(llist__lru_get_length(cache) == 1, "Expected the cache to hold 1 entry.\n");
+    cr_assert(nevicted == 1 && evicted[0] == 100, "Expected the replaced entry to be handed to the callback.\n");
+    cr_assert(llist__lru_get(cache, &keys[0]) == &values[1], "Expected the value to be replaced.\n");
+}
+
+Test(llist__lru_put, many, .init = setup, .fini = teardown) {
+    // only the 3 most recent of many keys survive
+    static int keys[1000];
+    for (int i = 0; i < 1000; i++) {
+        keys[i] = i;
+        llist__lru_put(cache, &keys[i], &keys[i]);
+        nevicted = 0;
+    }
+    for (int i = 0; i < 1000; i++) {
+        bool expected = i >= 997;
+        cr_assert(llist__lru_touch(cache, &keys[i]) == expected, "Expected key %d to be %s.\n", i,
+                  expected ? "cached" : "evicted");
+    }
+}
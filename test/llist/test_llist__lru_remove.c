@@ -0,0 +1,46 @@
+#include "llist/lru.h"
+#include <criterion/criterion.h>
+
+static llist__LruCache * cache = NULL;
+
+static int evicted[16];
+
+static size_t nevicted = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void record_eviction (const void * key, void *, void *) {
+    evicted[nevicted++] = *((const int *) key);
+}
+
+static void setup (void) {
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    cache = llist__lru_create(3, &ops, record_eviction, NULL);
+    nevicted = 0;
+}
+
+static void teardown (void) {
+    llist__lru_destroy(&cache);
+}
+
+Test(llist__lru_remove, without_callback, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 101, 102, 103, 104 };
+    double values[] = { 0.5, 1.5, 2.5, 3.5, 4.5 };
+    for (size_t i = 0; i < 3; i++) {
+        llist__lru_put(cache, &keys[i], &values[i]);
+    }
+    cr_assert(llist__lru_remove(cache, &keys[1]) == &values[1], "Expected the removed value to be returned.\n");
+    cr_assert(llist__lru_remove(cache, &keys[1]) == NULL, "Expected the entry to be gone.\n");
+    cr_assert(nevicted == 0, "Expected the callback not to be called.\n");
+    // the freed up entry is reused before anything is evicted
+    llist__lru_put(cache, &keys[3], &values[3]);
+    cr_assert(nevicted == 0, "Expected no evictions while there is room.\n");
+    llist__lru_put(cache, &keys[4], &values[4]);
+    cr_assert(nevicted == 1 && evicted[0] == 100, "Expected 100 to be evicted.\n");
+}
@@ -0,0 +1,41 @@
+#include "llist/lru.h"
+#include <criterion/criterion.h>
+
+static llist__LruCache * cache = NULL;
+
+static int evicted[16];
+
+static size_t nevicted = 0;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void record_eviction (const void * key, void *, void *) {
+    evicted[nevicted++] = *((const int *) key);
+}
+
+static void setup (void) {
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    cache = llist__lru_create(3, &ops, record_eviction, NULL);
+    nevicted = 0;
+}
+
+static void teardown (void) {
+    llist__lru_destroy(&cache);
+}
+
+Test(llist__lru_touch, null_value, .init = setup, .fini = teardown) {
+    static int keys[] = { 100, 101, 102, 103 };
+    llist__lru_put(cache, &keys[0], NULL);
+    llist__lru_put(cache, &keys[1], NULL);
+    llist__lru_put(cache, &keys[2], NULL);
+    cr_assert(llist__lru_touch(cache, &keys[0]), "Expected an entry with a NULL value to be found.\n");
+    cr_assert(!llist__lru_touch(cache, &keys[3]), "Expected no entry for 103.\n");
+    llist__lru_put(cache, &keys[3], NULL);
+    cr_assert(nevicted == 1 && evicted[0] == 101, "Expected 101 to be evicted instead of 100.\n");
+}
@@ -0,0 +1,65 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static int by_value (const void * a, const void * b, void *) {
+    int x = *((const int *) a);
+    int y = *((const int *) b);
+    return (x > y) - (x < y);
+}
+
+Test(llist__merge, three_sources, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103, 104, 105, 106, 107, 108 };
+    LinkedList * srcs[] = { llist__create(), llist__create(), llist__create() };
+    for (size_t i = 0; i < 9; i++) {
+        llist__append(i % 4 == 3 ? lst : srcs[i % 4], (void *) &arr[i]);
+    }
+    llist__merge(lst, srcs, 3, by_value, NULL);
+    for (size_t i = 0; i < 3; i++) {
+        cr_assert(llist__get_length(srcs[i]) == 0, "Expected source %zu to be empty.\n", i);
+        llist__destroy(&srcs[i]);
+    }
+    cr_assert(llist__pop_back(lst) == &arr[8], "Expected the largest item to be last.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104, 105, 106, 107]\n");
+}
+
+Test(llist__merge, stable_and_empty_sources, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 100, 101 };
+    LinkedList * srcs[] = { llist__create(), llist__create() };
+    llist__append(srcs[1], (void *) &arr[1]);
+    llist__append(srcs[1], (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[0]);
+    llist__merge(lst, srcs, 2, by_value, NULL);
+    cr_assert(llist__get(0, lst) == &arr[0], "Expected equal items from dst to come first.\n");
+    cr_assert(llist__get(1, lst) == &arr[1], "Expected equal items from dst to come first.\n");
+    llist__destroy(&srcs[0]);
+    llist__destroy(&srcs[1]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 100, 101]\n");
+}
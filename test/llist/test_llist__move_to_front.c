@@ -0,0 +1,81 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__move_to_front, middle_last_first, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    cr_assert(llist__move_to_front(lst, &arr[1]) == &arr[1], "Expected the moved item to be returned.\n");
+    llist__move_to_front(lst, &arr[3]);
+    llist__move_to_front(lst, &arr[3]);
+    llist__print(lst, &printers, stdout);
+    cr_assert(llist__pop_back(lst) == &arr[2], "Expected the last node to follow the moves.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[103, 101, 100, 102]\n[103, 101, 100]\n");
+}
+
+Test(llist__move_to_front, absent, .init = setup, .fini = teardown) {
+    int arr[] = { 100 };
+    llist__append(lst, (void *) &arr[0]);
+    int key = 101;
+    cr_assert(llist__move_to_front(lst, &key) == NULL, "Expected nothing to be moved.\n");
+}
+
+Test(llist__move_to_front, lru, .init = setup, .fini = teardown) {
+    // a cache of 3 items that evicts the least recently used one
+    int arr[] = { 100, 101, 102, 103, 104 };
+    int accesses[] = { 0, 1, 2, 0, 3, 1, 4 };
+    int evicted[4];
+    size_t nevicted = 0;
+    for (size_t i = 0; i < 7; i++) {
+        int * item = &arr[accesses[i]];
+        if (llist__move_to_front(lst, item) == NULL) {
+            if (llist__get_length(lst) == 3) {
+                evicted[nevicted++] = *((int *) llist__pop_back(lst));
+            }
+            llist__prepend(lst, item);
+        }
+    }
+    cr_assert(nevicted == 3, "Expected 3 evictions but got %zu.\n", nevicted);
+    cr_assert(evicted[0] == 101 && evicted[1] == 102 && evicted[2] == 100,
+              "Expected 101, 102 and 100 to be evicted in that order.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[104, 101, 103]\n");
+}
@@ -0,0 +1,68 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <stdlib.h>
+
+#define N 100000
+
+static int * values = NULL;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    values = malloc(sizeof(int) * N);
+    lst = llist__create();
+    for (int i = 0; i < N; i++) {
+        values[i] = i;
+        llist__append(lst, (void *) &values[i]);
+    }
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    free(values);
+}
+
+static bool is_multiple (void * p, void * ctx) {
+    return *((int *) p) % *((int *) ctx) == 0;
+}
+
+static bool always (void *, void *) {
+    return true;
+}
+
+Test(llist__parallel_filter, keeps_order, .init = setup, .fini = teardown) {
+    int three = 3;
+    size_t ndeleted = llist__parallel_filter(lst, is_multiple, &three, 4);
+    cr_assert(ndeleted == 33334, "Expected every multiple of 3 to be deleted.\n");
+    cr_assert(llist__get_length(lst) == N - 33334, "Expected the length to be updated.\n");
+    llist__Iter it = llist__iter_begin(lst);
+    int prev = -1;
+    while (llist__iter_next(&it)) {
+        int value = *((int *) llist__iter_get(&it));
+        cr_assert(value % 3 != 0 && value > prev, "Expected the remaining items in order.\n");
+        prev = value;
+    }
+    cr_assert(*((int *) llist__get(2, lst)) == 4, "Expected positional access to see the change.\n");
+}
+
+Test(llist__parallel_filter, same_as_delete, .init = setup, .fini = teardown) {
+    int seven = 7;
+    LinkedList * other = llist__create();
+    for (int i = 0; i < N; i++) {
+        llist__append(other, (void *) &values[i]);
+    }
+    llist__parallel_filter(lst, is_multiple, &seven, 3);
+    llist__delete_ctx(other, is_multiple, &seven, SIZE_MAX, NULL);
+    cr_assert(llist__get_length(lst) == llist__get_length(other), "Expected the same number of items.\n");
+    for (size_t i = 0; i < llist__get_length(lst); i += 997) {
+        cr_assert(llist__get(i, lst) == llist__get(i, other), "Expected the same items.\n");
+    }
+    llist__destroy(&other);
+}
+
+Test(llist__parallel_filter, everything, .init = setup, .fini = teardown) {
+    cr_assert(llist__parallel_filter(lst, always, NULL, 0) == N, "Expected every item to be deleted.\n");
+    cr_assert(llist__get_length(lst) == 0, "Expected an empty list.\n");
+    llist__append(lst, (void *) &values[0]);
+    cr_assert(llist__get(0, lst) == &values[0], "Expected the list to remain usable.\n");
+}
@@ -0,0 +1,66 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#define N 100000
+
+static int * values = NULL;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    values = malloc(sizeof(int) * N);
+    lst = llist__create();
+    for (int i = 0; i < N; i++) {
+        values[i] = i;
+        llist__append(lst, (void *) &values[i]);
+    }
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    free(values);
+}
+
+static void twice (void * p, void *) {
+    *((int *) p) *= 2;
+}
+
+static void count (void * p, void * ctx) {
+    atomic_fetch_add((atomic_size_t *) ctx, (size_t) (p != NULL));
+}
+
+Test(llist__parallel_for_each, every_item_once, .init = setup, .fini = teardown) {
+    llist__parallel_for_each(lst, twice, NULL, 4);
+    for (int i = 0; i < N; i++) {
+        cr_assert(values[i] == 2 * i, "Expected every item to be visited exactly once.\n");
+    }
+}
+
+Test(llist__parallel_for_each, after_changes, .init = setup, .fini = teardown) {
+    // the cached segmentation must not outlive changes to the list
+    atomic_size_t n;
+    atomic_init(&n, 0);
+    llist__parallel_for_each(lst, count, &n, 4);
+    cr_assert(atomic_load(&n) == N, "Expected every item to be visited.\n");
+    for (int i = 0; i < 5000; i++) {
+        llist__pop_front(lst);
+    }
+    llist__append(lst, (void *) &values[0]);
+    atomic_init(&n, 0);
+    llist__parallel_for_each(lst, count, &n, 4);
+    cr_assert(atomic_load(&n) == N - 4999, "Expected the changed list to be visited.\n");
+    LinkedList * tail = llist__split(lst, 1000);
+    atomic_init(&n, 0);
+    llist__parallel_for_each(lst, count, &n, 0);
+    cr_assert(atomic_load(&n) == 1000, "Expected the split list to be visited.\n");
+    llist__destroy(&tail);
+}
+
+Test(llist__parallel_for_each, empty) {
+    LinkedList * empty = llist__create();
+    llist__parallel_for_each(empty, twice, NULL, 4);
+    cr_assert(llist__get_length(empty) == 0, "Expected nothing to happen.\n");
+    llist__destroy(&empty);
+}
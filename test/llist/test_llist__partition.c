@@ -0,0 +1,62 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool is_below (void * p, void * ctx) {
+    return *((int *) p) < *((int *) ctx);
+}
+
+Test(llist__partition, around_pivot, .init = setup, .fini = teardown) {
+    int arr[] = { 104, 101, 105, 100, 103, 102 };
+    for (size_t i = 0; i < 6; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    int pivot = 103;
+    LinkedList * below = llist__create();
+    size_t n = llist__partition(lst, is_below, &pivot, below);
+    cr_assert(n == 3, "Expected 3 items to be moved but moved %zu.\n", n);
+    cr_assert(llist__get_length(lst) == 3, "Expected 3 items to remain.\n");
+    llist__print(below, &printers, stdout);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 100, 102]\n[104, 105, 103]\n");
+    llist__destroy(&below);
+}
+
+Test(llist__partition, nothing_matches, .init = setup, .fini = teardown) {
+    int arr[] = { 104, 105 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    int pivot = 100;
+    LinkedList * below = llist__create();
+    size_t n = llist__partition(lst, is_below, &pivot, below);
+    cr_assert(n == 0, "Expected no items to be moved but moved %zu.\n", n);
+    llist__print(below, &printers, stdout);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[]\n[104, 105]\n");
+    llist__destroy(&below);
+}
@@ -0,0 +1,20 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+Test(llist__pool_destroy, noop) {
+    llist__NodePool * pool = llist__pool_create(16);
+    llist__pool_destroy(&pool);
+    cr_assert(pool == NULL, "Node pool should be NULL after it has been destroyed.\n");
+}
+
+Test(llist__pool_destroy, after_destroying_lists) {
+    int arr[] = { 100, 101, 102 };
+    llist__NodePool * pool = llist__pool_create(2);
+    LinkedList * lst = llist__create_with_pool(pool);
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__destroy(&lst);
+    llist__pool_destroy(&pool);
+    cr_assert(pool == NULL, "Node pool should be NULL after it has been destroyed.\n");
+}
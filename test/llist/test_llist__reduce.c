@@ -0,0 +1,86 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <stdlib.h>
+
+#define N 100000
+
+static double * values = NULL;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    values = malloc(sizeof(double) * N);
+    lst = llist__create();
+    for (int i = 0; i < N; i++) {
+        values[i] = 1.0 / (i + 1);
+        llist__append(lst, (void *) &values[i]);
+    }
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    free(values);
+}
+
+static void add (void * acc, void * item, void *) {
+    *((double *) acc) += *((double *) item);
+}
+
+static void add_partial (void * acc, const void * other, void *) {
+    *((double *) acc) += *((const double *) other);
+}
+
+typedef struct {
+    size_t n;
+    double first;
+    double last;
+} Span;
+
+static void span_step (void * acc, void * item, void *) {
+    Span * span = acc;
+    if (span->n == 0) {
+        span->first = *((double *) item);
+    }
+    span->last = *((double *) item);
+    span->n++;
+}
+
+static void span_combine (void * acc, const void * other, void *) {
+    Span * span = acc;
+    const Span * right = other;
+    if (right->n == 0) return;
+    if (span->n == 0) {
+        span->first = right->first;
+    }
+    span->last = right->last;
+    span->n += right->n;
+}
+
+Test(llist__reduce, deterministic_sum, .init = setup, .fini = teardown) {
+    llist__Reducer sum = { .size = sizeof(double), .step = add, .combine = add_partial };
+    double serial = 0.0;
+    llist__reduce(lst, &sum, &serial, 1);
+    cr_assert(serial > 12.09 && serial < 12.10, "Expected the harmonic number H(100000).\n");
+    for (size_t nthreads = 2; nthreads <= 8; nthreads++) {
+        double parallel = 0.0;
+        llist__reduce(lst, &sum, &parallel, nthreads);
+        cr_assert(parallel == serial, "Expected bitwise identical results for any number of threads.\n");
+    }
+}
+
+Test(llist__reduce, combines_in_order, .init = setup, .fini = teardown) {
+    llist__Reducer reducer = { .size = sizeof(Span), .step = span_step, .combine = span_combine };
+    Span span = { 0 };
+    llist__reduce(lst, &reducer, &span, 4);
+    cr_assert(span.n == N, "Expected every item to be counted.\n");
+    cr_assert(span.first == values[0] && span.last == values[N - 1], "Expected partials combined in order.\n");
+}
+
+Test(llist__reduce, empty) {
+    LinkedList * empty = llist__create();
+    llist__Reducer sum = { .size = sizeof(double), .step = add, .combine = add_partial };
+    double total = 42.0;
+    llist__reduce(empty, &sum, &total, 4);
+    cr_assert(total == 42.0, "Expected the initial accumulator back.\n");
+    llist__destroy(&empty);
+}
@@ -0,0 +1,52 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103, 104 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[3]);
+    llist__append(lst, (void *) &arr[4]);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__remove, first_middle_last, .init = setup, .fini = teardown) {
+    cr_assert(llist__remove(2, lst) == &arr[2], "Expected the middle item to be returned.\n");
+    cr_assert(llist__remove(3, lst) == &arr[4], "Expected the last item to be returned.\n");
+    cr_assert(llist__remove(0, lst) == &arr[0], "Expected the first item to be returned.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 103]\n");
+}
+
+Test(llist__remove, first_middle_last_indexed, .init = setup, .fini = teardown) {
+    llist__set_indexed(lst, true);
+    cr_assert(llist__remove(2, lst) == &arr[2], "Expected the middle item to be returned.\n");
+    cr_assert(llist__remove(3, lst) == &arr[4], "Expected the last item to be returned.\n");
+    cr_assert(llist__remove(0, lst) == &arr[0], "Expected the first item to be returned.\n");
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 103]\n");
+}
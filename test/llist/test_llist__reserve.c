@@ -0,0 +1,104 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nfrees;
+} Counts;
+
+static void * counting_alloc (size_t size, void * ctx) {
+    ((Counts *) ctx)->nallocs++;
+    return malloc(size);
+}
+
+static void counting_free (void * p, size_t, void * ctx) {
+    ((Counts *) ctx)->nfrees++;
+    free(p);
+}
+
+static Counts counts = { .nallocs = 0, .nfrees = 0 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    counts = (Counts) { .nallocs = 0, .nfrees = 0 };
+    llist__Allocator allocator = { .alloc = counting_alloc, .free = counting_free, .ctx = &counts };
+    lst = llist__try_create(&allocator);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    cr_assert(counts.nallocs == counts.nfrees, "Expected every allocation to be freed.\n");
+}
+
+Test(llist__reserve, steady_state_queue, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    // the list itself and four nodes; popping and appending recycles nodes
+    // once the list opts in to keeping them
+    llist__reserve(lst, 4);
+    cr_assert(counts.nallocs == 5, "Expected 5 allocations but counted %zu.\n", counts.nallocs);
+    for (size_t i = 0; i < 1000; i++) {
+        llist__append(lst, llist__pop_front(lst));
+    }
+    cr_assert(counts.nallocs == 5 && counts.nfrees == 0, "Expected the queue not to call the allocator.\n");
+    cr_assert(llist__get(0, lst) == &arr[0] && llist__get(3, lst) == &arr[3], "Expected the order to be kept.\n");
+}
+
+Test(llist__reserve, up_front, .init = setup, .fini = teardown) {
+    int item = 0;
+    llist__reserve(lst, 100);
+    cr_assert(counts.nallocs == 101, "Expected 100 spare nodes.\n");
+    for (size_t i = 0; i < 100; i++) {
+        llist__prepend(lst, (void *) &item);
+    }
+    while (llist__get_length(lst) > 0) {
+        llist__pop_back(lst);
+    }
+    for (size_t i = 0; i < 100; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    cr_assert(counts.nallocs == 101 && counts.nfrees == 0,
+              "Expected the reserved nodes to be reused, but counted %zu allocations and %zu frees.\n",
+              counts.nallocs, counts.nfrees);
+    llist__append(lst, (void *) &item);
+    cr_assert(counts.nallocs == 102, "Expected growing past the reservation to allocate.\n");
+}
+
+Test(llist__reserve, counts_existing_items, .init = setup, .fini = teardown) {
+    int item = 0;
+    for (size_t i = 0; i < 10; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    llist__reserve(lst, 4);
+    cr_assert(counts.nallocs == 11, "Expected no spare nodes for a list that is long enough.\n");
+    llist__reserve(lst, 16);
+    cr_assert(counts.nallocs == 17, "Expected 6 spare nodes.\n");
+}
+
+Test(llist__reserve, none_by_default, .init = setup, .fini = teardown) {
+    // a list with an allocator hands back every node it deletes
+    int item = 0;
+    for (size_t i = 0; i < LLIST_SPARES + 10; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    while (llist__get_length(lst) > 0) {
+        llist__pop_front(lst);
+    }
+    cr_assert(counts.nfrees == LLIST_SPARES + 10, "Expected all nodes to be freed, but %zu were.\n", counts.nfrees);
+}
+
+Test(llist__reserve, bounded, .init = setup, .fini = teardown) {
+    int item = 0;
+    llist__reserve(lst, 16);
+    for (size_t i = 0; i < 26; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    while (llist__get_length(lst) > 0) {
+        llist__pop_front(lst);
+    }
+    cr_assert(counts.nfrees == 10, "Expected only 16 nodes to be kept, but %zu were freed.\n", counts.nfrees);
+}
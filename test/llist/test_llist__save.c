@@ -0,0 +1,108 @@
+#define _POSIX_C_SOURCE 200809L
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static LinkedList * lst = NULL;
+
+static char path[] = "/tmp/test_llist__save_XXXXXX";
+
+static int fd = -1;
+
+static void setup (void) {
+    lst = llist__create();
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    fd = mkstemp(path);
+    cr_assert(fd >= 0, "Expected a temporary file.\n");
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    close(fd);
+    unlink(path);
+}
+
+static size_t int_size (const void *, void *) {
+    return sizeof(int);
+}
+
+static size_t string_size (const void * p, void *) {
+    return strlen((const char *) p) + 1;
+}
+
+static void negate (void * dst, const void * p, void *) {
+    int value = -*((const int *) p);
+    memcpy(dst, &value, sizeof(value));
+}
+
+Test(llist__save, header_and_records, .init = setup, .fini = teardown) {
+    llist__Codec codec = { .size = int_size };
+    cr_assert(llist__save(lst, fd, &codec), "Expected saving to succeed.\n");
+    uint64_t words[8];
+    cr_assert(pread(fd, words, sizeof(words), 0) == sizeof(words), "Expected a 64 byte header.\n");
+    cr_assert(memcmp(words, "LLSNAP01", 8) == 0, "Expected the header to start with the magic.\n");
+    cr_assert(words[3] == 4, "Expected the header to hold the number of items.\n");
+
+    // the records follow the header in list order, linked by offset
+    uint64_t records[4][3];
+    cr_assert(pread(fd, records, sizeof(records), (off_t) words[4]) == sizeof(records), "Expected 4 records.\n");
+    cr_assert(records[0][2] == 0 && records[3][1] == 0, "Expected the ends of the chain to be 0.\n");
+    cr_assert(records[1][1] == words[4] + 2 * sizeof(records[0]), "Expected next to hold the offset of a record.\n");
+    int value = 0;
+    cr_assert(pread(fd, &value, sizeof(value), (off_t) records[2][0]) == sizeof(value), "Expected a payload.\n");
+    cr_assert(value == 102, "Expected the payload bytes at the payload offset.\n");
+}
+
+Test(llist__save, roundtrip_strings, .init = setup, .fini = teardown) {
+    LinkedList * words = llist__create();
+    llist__append(words, "to");
+    llist__append(words, "be, or not");
+    llist__append(words, "");
+    llist__Codec codec = { .size = string_size };
+    cr_assert(llist__save(words, fd, &codec), "Expected saving to succeed.\n");
+    llist__destroy(&words);
+
+    LinkedList * loaded = llist__load_mmap(path);
+    cr_assert(loaded != NULL, "Expected loading to succeed.\n");
+    cr_assert(strcmp(llist__get(0, loaded), "to") == 0, "Expected the first string back.\n");
+    cr_assert(strcmp(llist__get(1, loaded), "be, or not") == 0, "Expected the second string back.\n");
+    cr_assert(strcmp(llist__get(2, loaded), "") == 0, "Expected the empty string back.\n");
+    cr_assert(((uintptr_t) llist__get(1, loaded)) % 16 == 0, "Expected payloads to be aligned.\n");
+    llist__destroy(&loaded);
+}
+
+Test(llist__save, custom_encode, .init = setup, .fini = teardown) {
+    llist__Codec codec = { .size = int_size, .encode = negate };
+    cr_assert(llist__save(lst, fd, &codec), "Expected saving to succeed.\n");
+    LinkedList * loaded = llist__load_mmap(path);
+    cr_assert(*((int *) llist__get(3, loaded)) == -103, "Expected the encoded payload.\n");
+    llist__destroy(&loaded);
+}
+
+Test(llist__save, raw_pointers, .init = setup, .fini = teardown) {
+    LinkedList * ids = llist__create();
+    for (uintptr_t i = 1; i <= 3; i++) {
+        llist__append(ids, (void *) i);
+    }
+    cr_assert(llist__save(ids, fd, NULL), "Expected saving to succeed.\n");
+    llist__destroy(&ids);
+    LinkedList * loaded = llist__load_mmap(path);
+    cr_assert(llist__get(2, loaded) == (void *) 3, "Expected the pointer values themselves back.\n");
+    llist__destroy(&loaded);
+}
+
+Test(llist__save, bad_fd, .init = setup, .fini = teardown) {
+    llist__Codec codec = { .size = int_size };
+    errno = 0;
+    cr_assert(!llist__save(lst, -1, &codec), "Expected saving to a bad file descriptor to fail.\n");
+    cr_assert(errno == EBADF, "Expected errno to say why.\n");
+}
@@ -0,0 +1,82 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static bool filter (void * p) {
+    return *((int *) p) % 5 == 0;
+}
+
+Test(llist__set_indexed, mixed_operations, .init = setup, .fini = teardown) {
+    // mirror a pseudo-random sequence of operations in a plain array
+    int arr[2000];
+    int * expected[2000];
+    size_t n = 0;
+    unsigned int seed = 12345;
+    llist__set_indexed(lst, true);
+    for (size_t i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        unsigned int r = (seed >> 8);
+        arr[i] = (int) i;
+        if (r % 4 != 0 || n == 0) {
+            size_t pos = r % (n + 1);
+            for (size_t j = n; j > pos; j--) {
+                expected[j] = expected[j - 1];
+            }
+            expected[pos] = &arr[i];
+            n++;
+            llist__insert(pos, (void *) &arr[i], lst);
+        } else {
+            size_t pos = r % n;
+            int * actual = llist__remove(pos, lst);
+            cr_assert(actual == expected[pos], "Expected removal at %zu to return the mirrored item.\n", pos);
+            for (size_t j = pos; j + 1 < n; j++) {
+                expected[j] = expected[j + 1];
+            }
+            n--;
+        }
+        if (i == 1000) {
+            // relinks the nodes, which makes the index stale
+            llist__delete(true, lst, filter);
+            size_t nkept = 0;
+            for (size_t j = 0; j < n; j++) {
+                if (!filter(expected[j])) {
+                    expected[nkept++] = expected[j];
+                }
+            }
+            n = nkept;
+            llist__append(lst, (void *) &arr[i]);
+            llist__pop_front(lst);
+            llist__pop_back(lst);
+            expected[n] = &arr[i];
+            for (size_t j = 0; j < n; j++) {
+                expected[j] = expected[j + 1];
+            }
+            n--;
+        }
+    }
+    cr_assert(llist__get_length(lst) == n, "Expected %zu items but found %zu.\n", n, llist__get_length(lst));
+    for (size_t j = 0; j < n; j++) {
+        cr_assert(llist__get(j, lst) == expected[j], "Expected item %zu to match the mirror.\n", j);
+    }
+}
+
+Test(llist__set_indexed, switch_off, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__set_indexed(lst, true);
+    llist__append(lst, (void *) &arr[2]);
+    llist__insert(1, (void *) &arr[1], lst);
+    llist__set_indexed(lst, false);
+    for (size_t j = 0; j < 3; j++) {
+        cr_assert(llist__get(j, lst) == &arr[j], "Expected item %zu to be %d.\n", j, arr[j]);
+    }
+}
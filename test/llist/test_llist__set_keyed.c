@@ -0,0 +1,121 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+typedef struct {
+    int id;
+    double value;
+} Record;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static const void * record_id (const void * item, void *) {
+    return &((const Record *) item)->id;
+}
+
+static bool is_odd (void * p) {
+    return *((int *) p) % 2 != 0;
+}
+
+Test(llist__set_keyed, existing_items, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102 };
+    for (size_t i = 0; i < 3; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    int key = 101;
+    cr_assert(llist__find(lst, &key) == &arr[1], "Expected to find the item that was there before keying.\n");
+}
+
+Test(llist__set_keyed, key_function, .init = setup, .fini = teardown) {
+    Record records[] = { { .id = 7, .value = 0.5 }, { .id = 3, .value = 1.5 } };
+    llist__KeyOps ops = { .key = record_id, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    llist__append(lst, (void *) &records[0]);
+    llist__append(lst, (void *) &records[1]);
+    int key = 3;
+    Record * found = llist__find(lst, &key);
+    cr_assert(found == &records[1], "Expected to find the record by its id.\n");
+}
+
+Test(llist__set_keyed, mixed_operations, .init = setup, .fini = teardown) {
+    // grow well past the initial table and shuffle items in and out
+    int arr[5000];
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    for (int i = 0; i < 5000; i++) {
+        arr[i] = i;
+        if (i % 3 == 0) {
+            llist__prepend(lst, (void *) &arr[i]);
+        } else {
+            llist__insert(llist__get_length(lst) / 2, (void *) &arr[i], lst);
+        }
+    }
+    for (size_t i = 0; i < 1000; i++) {
+        llist__remove(llist__get_length(lst) / 3, lst);
+        llist__pop_front(lst);
+    }
+    llist__delete(true, lst, is_odd);
+    size_t n = 0;
+    for (int i = 0; i < 5000; i++) {
+        bool expected = false;
+        for (size_t j = 0; j < llist__get_length(lst); j++) {
+            if (llist__get(j, lst) == &arr[i]) {
+                expected = true;
+                break;
+            }
+        }
+        cr_assert(llist__contains(lst, &arr[i]) == expected, "Expected the keyed index to agree with the list for %d.\n", i);
+        n += expected;
+    }
+    cr_assert(n == llist__get_length(lst), "Expected every item in the list to be keyed.\n");
+}
+
+Test(llist__set_keyed, stale_after_splice, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    LinkedList * other = llist__create();
+    llist__set_keyed(other, &ops);
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(other, (void *) &arr[2]);
+    llist__append(other, (void *) &arr[3]);
+    llist__splice(lst, 1, other);
+    cr_assert(llist__contains(lst, &arr[2]), "Expected spliced items to be keyed in the destination.\n");
+    cr_assert(!llist__contains(other, &arr[2]), "Expected spliced items to be gone from the source.\n");
+    LinkedList * tail = llist__split(lst, 2);
+    // lst was [100, 102, 103, 101]
+    cr_assert(!llist__contains(lst, &arr[1]), "Expected split off items to be gone from the keyed index.\n");
+    cr_assert(!llist__contains(lst, &arr[3]), "Expected split off items to be gone from the keyed index.\n");
+    cr_assert(llist__contains(lst, &arr[2]), "Expected remaining items to stay keyed.\n");
+    llist__destroy(&tail);
+    llist__destroy(&other);
+}
+
+Test(llist__set_keyed, switch_off, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101 };
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(lst, &ops);
+    llist__append(lst, (void *) &arr[0]);
+    llist__set_keyed(lst, NULL);
+    llist__append(lst, (void *) &arr[1]);
+    llist__set_keyed(lst, &ops);
+    cr_assert(llist__find(lst, &arr[1]) == &arr[1], "Expected items added while unkeyed to be keyed again.\n");
+}
@@ -0,0 +1,127 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103, 104, 105 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    for (size_t i = 0; i < 6; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool is_negative (void * p) {
+    return *((int *) p) < 0;
+}
+
+static bool is_odd (void * p) {
+    return *((int *) p) % 2 != 0;
+}
+
+static bool is_104 (void * p) {
+    return *((int *) p) == 104;
+}
+
+static bool is_multiple_of (void * p, void * ctx) {
+    return *((int *) p) % *((int *) ctx) == 0;
+}
+
+Test(llist__set_prefetch, delete_all, .init = setup, .fini = teardown) {
+    llist__set_prefetch(lst, 2, true);
+    llist__delete(true, lst, is_odd);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 104]\n");
+}
+
+Test(llist__set_prefetch, delete_first, .init = setup, .fini = teardown) {
+    llist__set_prefetch(lst, 1, false);
+    llist__delete(false, lst, is_odd);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 103, 104, 105]\n");
+}
+
+Test(llist__set_prefetch, delete_ctx, .init = setup, .fini = teardown) {
+    llist__set_prefetch(lst, 3, true);
+    int divisor = 3;
+    size_t n = llist__delete_ctx(lst, is_multiple_of, &divisor, SIZE_MAX, NULL);
+    cr_assert(n == 2, "Expected 2 items to be deleted but deleted %zu.\n", n);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 103, 104]\n");
+}
+
+Test(llist__set_prefetch, distance_beyond_the_end, .init = setup, .fini = teardown) {
+    llist__set_prefetch(lst, 64, true);
+    llist__delete(true, lst, is_odd);
+    llist__print(lst, &printers, stdout);
+    llist__print(lst, NULL, stdout);
+    fflush(stdout);
+    char expected[128];
+    snprintf(expected, sizeof(expected), "[100, 102, 104]\n[%p, %p, %p]\n", (void *) &arr[0], (void *) &arr[2],
+             (void *) &arr[4]);
+    cr_assert_stdout_eq_str(expected);
+}
+
+Test(llist__set_prefetch, switched_off, .init = setup, .fini = teardown) {
+    llist__set_prefetch(lst, 4, true);
+    llist__set_prefetch(lst, 0, true);
+    llist__delete(true, lst, is_odd);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 104]\n");
+}
+
+Test(llist__set_prefetch, replayed_traversals, .init = setup, .fini = teardown) {
+    llist__set_prefetch(lst, 1, true);
+    llist__delete(true, lst, is_negative);
+    llist__delete(true, lst, is_odd);
+    llist__delete(false, lst, is_104);
+    llist__print(lst, &printers, stdout);
+    llist__delete(true, lst, is_odd);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102]\n[100, 102]\n");
+}
+
+Test(llist__set_prefetch, changed_between_traversals, .init = setup, .fini = teardown) {
+    static int extra[] = { 99, 98 };
+    llist__set_prefetch(lst, 2, false);
+    llist__delete(true, lst, is_negative);
+    llist__prepend(lst, (void *) &extra[0]);
+    llist__delete(true, lst, is_odd);
+    llist__append(lst, (void *) &extra[1]);
+    llist__print(lst, &printers, stdout);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 104, 98]\n[100, 102, 104, 98]\n");
+}
+
+Test(llist__set_prefetch, empty) {
+    LinkedList * empty = llist__create();
+    llist__set_prefetch(empty, 8, true);
+    llist__delete(true, empty, is_odd);
+    cr_assert(llist__get_length(empty) == 0, "Expected the list to remain empty.\n");
+    llist__destroy(&empty);
+}
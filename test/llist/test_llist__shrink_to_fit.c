@@ -0,0 +1,71 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nfrees;
+} Counts;
+
+static void * counting_alloc (size_t size, void * ctx) {
+    ((Counts *) ctx)->nallocs++;
+    return malloc(size);
+}
+
+static void counting_free (void * p, size_t, void * ctx) {
+    ((Counts *) ctx)->nfrees++;
+    free(p);
+}
+
+static Counts counts = { .nallocs = 0, .nfrees = 0 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    counts = (Counts) { .nallocs = 0, .nfrees = 0 };
+    llist__Allocator allocator = { .alloc = counting_alloc, .free = counting_free, .ctx = &counts };
+    lst = llist__try_create(&allocator);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    cr_assert(counts.nallocs == counts.nfrees, "Expected every allocation to be freed.\n");
+}
+
+Test(llist__shrink_to_fit, releases_spares, .init = setup, .fini = teardown) {
+    int item = 0;
+    llist__reserve(lst, 8);
+    llist__append(lst, (void *) &item);
+    llist__shrink_to_fit(lst);
+    cr_assert(counts.nfrees == 7, "Expected the 7 unused spare nodes to be freed.\n");
+    cr_assert(llist__get(0, lst) == &item, "Expected the item to remain.\n");
+}
+
+Test(llist__shrink_to_fit, stops_keeping_nodes, .init = setup, .fini = teardown) {
+    int item = 0;
+    llist__shrink_to_fit(lst);
+    llist__append(lst, (void *) &item);
+    llist__pop_front(lst);
+    cr_assert(counts.nfrees == 1, "Expected the popped node to be freed right away.\n");
+    llist__reserve(lst, 1);
+    llist__append(lst, (void *) &item);
+    llist__pop_front(lst);
+    cr_assert(counts.nfrees == 1, "Expected reserving to keep nodes again.\n");
+}
+
+Test(llist__shrink_to_fit, pooled) {
+    // spare nodes of a pooled list go back to the pool, where other lists find them
+    int item = 0;
+    llist__NodePool * pool = llist__pool_create(16);
+    LinkedList * a = llist__create_with_pool(pool);
+    LinkedList * b = llist__create_with_pool(pool);
+    llist__reserve(a, 4);
+    llist__shrink_to_fit(a);
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(b, (void *) &item);
+    }
+    cr_assert(llist__get_length(b) == 4, "Expected 4 items.\n");
+    llist__destroy(&a);
+    llist__destroy(&b);
+    llist__pool_destroy(&pool);
+}
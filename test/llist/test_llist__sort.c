@@ -0,0 +1,98 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    int key;
+    char tag;
+} MyStruct;
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    MyStruct my_struct = *((MyStruct *) elem);
+    fprintf(fd, "%d%c%s", my_struct.key, my_struct.tag, idx < nelems - 1 ? ", " : "");
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static int by_key (const void * a, const void * b, void *) {
+    int x = ((const MyStruct *) a)->key;
+    int y = ((const MyStruct *) b)->key;
+    return (x > y) - (x < y);
+}
+
+static int by_value (const void * a, const void * b, void * ctx) {
+    int x = *((const int *) a);
+    int y = *((const int *) b);
+    return *((int *) ctx) * ((x > y) - (x < y));
+}
+
+Test(llist__sort, empty, .init = setup, .fini = teardown) {
+    llist__sort(lst, by_key, NULL);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[]\n");
+}
+
+Test(llist__sort, stable, .init = setup, .fini = teardown) {
+    MyStruct arr[] = {
+        { .key = 3, .tag = 'a' },
+        { .key = 1, .tag = 'a' },
+        { .key = 3, .tag = 'b' },
+        { .key = 2, .tag = 'a' },
+        { .key = 1, .tag = 'b' },
+        { .key = 3, .tag = 'c' },
+        { .key = 0, .tag = 'a' }
+    };
+    for (size_t i = 0; i < 7; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__sort(lst, by_key, NULL);
+    llist__append(lst, (void *) &arr[6]);
+    llist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[0a, 1a, 1b, 2a, 3a, 3b, 3c, 0a]\n");
+}
+
+Test(llist__sort, many_items_with_context, .init = setup, .fini = teardown) {
+    int arr[1000];
+    unsigned int seed = 12345;
+    for (size_t i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        arr[i] = (int) ((seed >> 8) % 500);
+        llist__append(lst, (void *) &arr[i]);
+    }
+    int descending = -1;
+    llist__sort(lst, by_value, &descending);
+    cr_assert(llist__get_length(lst) == 1000, "Expected the number of items to be unchanged.\n");
+
+    // forwards through the next links
+    llist__Iter it = llist__iter_begin(lst);
+    llist__iter_next(&it);
+    int prev = *((int *) llist__iter_get(&it));
+    while (llist__iter_next(&it)) {
+        int curr = *((int *) llist__iter_get(&it));
+        cr_assert(curr <= prev, "Expected items to be sorted in descending order.\n");
+        prev = curr;
+    }
+
+    // backwards through the prev links
+    prev = *((int *) llist__pop_back(lst));
+    while (llist__get_length(lst) > 0) {
+        int curr = *((int *) llist__pop_back(lst));
+        cr_assert(curr >= prev, "Expected items to be sorted in descending order.\n");
+        prev = curr;
+    }
+}
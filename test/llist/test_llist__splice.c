@@ -0,0 +1,72 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <stdlib.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103, 104, 105 };
+
+static LinkedList * dst = NULL;
+
+static LinkedList * src = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    dst = llist__create();
+    src = llist__create();
+    llist__append(dst, (void *) &arr[0]);
+    llist__append(dst, (void *) &arr[1]);
+    llist__append(dst, (void *) &arr[2]);
+    llist__append(src, (void *) &arr[3]);
+    llist__append(src, (void *) &arr[4]);
+    llist__append(src, (void *) &arr[5]);
+}
+
+static void teardown (void) {
+    llist__destroy(&dst);
+    llist__destroy(&src);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__splice, at_front, .init = setup, .fini = teardown) {
+    llist__splice(dst, 0, src);
+    llist__print(dst, &printers, stdout);
+    llist__print(src, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[103, 104, 105, 100, 101, 102]\n[]\n");
+}
+
+Test(llist__splice, in_middle, .init = setup, .fini = teardown) {
+    llist__splice(dst, 1, src);
+    llist__append(src, (void *) &arr[0]);
+    llist__print(dst, &printers, stdout);
+    llist__print(src, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 103, 104, 105, 101, 102]\n[100]\n");
+}
+
+Test(llist__splice, at_end, .init = setup, .fini = teardown) {
+    llist__splice(dst, 3, src);
+    cr_assert(llist__pop_back(dst) == &arr[5], "Expected the last item of src to end up last.\n");
+    llist__print(dst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104]\n");
+}
+
+Test(llist__splice, different_pools, .exit_code = EXIT_FAILURE) {
+    llist__NodePool * pool = llist__pool_create(16);
+    LinkedList * pooled = llist__create_with_pool(pool);
+    LinkedList * plain = llist__create();
+    llist__append(pooled, (void *) &arr[0]);
+    llist__splice(plain, 0, pooled);
+}
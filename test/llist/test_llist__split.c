@@ -0,0 +1,72 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = llist__create();
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    llist__append(lst, (void *) &arr[2]);
+    llist__append(lst, (void *) &arr[3]);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(llist__split, in_middle, .init = setup, .fini = teardown) {
+    LinkedList * tail = llist__split(lst, 1);
+    llist__append(lst, (void *) &arr[0]);
+    llist__prepend(tail, (void *) &arr[0]);
+    llist__print(lst, &printers, stdout);
+    llist__print(tail, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 100]\n[100, 101, 102, 103]\n");
+    llist__destroy(&tail);
+}
+
+Test(llist__split, at_front_and_end, .init = setup, .fini = teardown) {
+    LinkedList * none = llist__split(lst, 4);
+    LinkedList * all = llist__split(lst, 0);
+    llist__print(lst, &printers, stdout);
+    llist__print(none, &printers, stdout);
+    llist__print(all, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[]\n[]\n[100, 101, 102, 103]\n");
+    llist__destroy(&none);
+    llist__destroy(&all);
+}
+
+Test(llist__split, pooled, .init = setup, .fini = teardown) {
+    llist__NodePool * pool = llist__pool_create(2);
+    LinkedList * pooled = llist__create_with_pool(pool);
+    llist__append(pooled, (void *) &arr[0]);
+    llist__append(pooled, (void *) &arr[1]);
+    llist__append(pooled, (void *) &arr[2]);
+    LinkedList * tail = llist__split(pooled, 2);
+    llist__append(tail, (void *) &arr[3]);
+    llist__splice(pooled, 0, tail);
+    llist__print(pooled, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[102, 103, 100, 101]\n");
+    llist__destroy(&tail);
+    llist__destroy(&pooled);
+    llist__pool_destroy(&pool);
+}
@@ -0,0 +1,86 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    lst = llist__create();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+#ifdef LLIST_STATS
+
+static bool is_odd (void * p) {
+    return *((int *) p) % 2 != 0;
+}
+
+Test(llist__stats, counts_operations, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103, 104, 105 };
+    for (size_t i = 0; i < 6; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__get(2, lst);
+    llist__pop_front(lst);
+    llist__delete(true, lst, is_odd);
+    llist__Stats stats;
+    cr_assert(llist__stats(lst, &stats), "Expected the library to count operations.\n");
+    cr_assert(stats.ops[LLIST_STATS_INSERT].count == 6, "Expected 6 inserts.\n");
+    cr_assert(stats.ops[LLIST_STATS_GET].count == 1, "Expected 1 get.\n");
+    cr_assert(stats.ops[LLIST_STATS_GET].nodes == 2, "Expected the get to walk 2 nodes.\n");
+    cr_assert(stats.ops[LLIST_STATS_REMOVE].count == 1, "Expected 1 removal.\n");
+    cr_assert(stats.ops[LLIST_STATS_DELETE].count == 1, "Expected 1 delete.\n");
+    cr_assert(stats.ops[LLIST_STATS_DELETE].nodes == 5, "Expected the delete to visit 5 nodes.\n");
+    cr_assert(stats.nallocs == 6 && stats.nfrees == 4, "Expected 6 allocations and 4 frees.\n");
+    uint64_t nlatencies = 0;
+    for (size_t b = 0; b < LLIST_STATS_NBUCKETS; b++) {
+        nlatencies += stats.ops[LLIST_STATS_INSERT].latency[b];
+    }
+    cr_assert(nlatencies == 6, "Expected every insert to be timed.\n");
+}
+
+Test(llist__stats, quadratic_pattern, .init = setup, .fini = teardown) {
+    // getting every item by position walks O(n^2) nodes in total
+    int item = 0;
+    for (size_t i = 0; i < 100; i++) {
+        llist__append(lst, (void *) &item);
+    }
+    for (size_t i = 0; i < 100; i++) {
+        llist__get(i, lst);
+    }
+    llist__Stats stats;
+    llist__stats(lst, &stats);
+    cr_assert(stats.ops[LLIST_STATS_GET].nodes == 2 * (49 * 50 / 2),
+              "Expected the gets to walk from the nearest end, but they walked %llu nodes.\n",
+              (unsigned long long) stats.ops[LLIST_STATS_GET].nodes);
+}
+
+Test(llist__stats, global_totals, .init = setup, .fini = teardown) {
+    int item = 0;
+    llist__Stats before;
+    llist__stats(NULL, &before);
+    LinkedList * other = llist__create();
+    llist__append(lst, (void *) &item);
+    llist__append(other, (void *) &item);
+    llist__destroy(&other);
+    llist__Stats after;
+    cr_assert(llist__stats(NULL, &after), "Expected the library to count operations.\n");
+    cr_assert(after.ops[LLIST_STATS_INSERT].count - before.ops[LLIST_STATS_INSERT].count == 2,
+              "Expected the totals to count the inserts into both lists.\n");
+    cr_assert(after.nfrees - before.nfrees == 1, "Expected the totals to count the destroyed node.\n");
+}
+
+#else
+
+Test(llist__stats, disabled, .init = setup, .fini = teardown) {
+    int item = 0;
+    llist__append(lst, (void *) &item);
+    llist__Stats stats;
+    cr_assert(!llist__stats(lst, &stats), "Expected the library not to count operations.\n");
+    cr_assert(stats.ops[LLIST_STATS_INSERT].count == 0 && stats.nallocs == 0, "Expected zeros.\n");
+    cr_assert(!llist__stats(NULL, &stats), "Expected the library not to count operations.\n");
+}
+
+#endif
@@ -0,0 +1,45 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <stdio.h>
+#include <string.h>
+
+static void setup (void) {
+    cr_redirect_stdout();
+}
+
+static void append_histogram (char * out, const uint64_t * latency) {
+    strcat(out, "[");
+    for (size_t b = 0; b < LLIST_STATS_NBUCKETS; b++) {
+        char number[32];
+        snprintf(number, sizeof(number), "%s%llu", b == 0 ? "" : ", ", (unsigned long long) latency[b]);
+        strcat(out, number);
+    }
+    strcat(out, "]");
+}
+
+Test(llist__stats_dump, json, .init = setup) {
+    llist__Stats stats = { .nallocs = 3, .nfrees = 1 };
+    stats.ops[LLIST_STATS_INSERT].count = 3;
+    stats.ops[LLIST_STATS_INSERT].latency[5] = 2;
+    stats.ops[LLIST_STATS_INSERT].latency[6] = 1;
+    stats.ops[LLIST_STATS_GET].count = 1;
+    stats.ops[LLIST_STATS_GET].nodes = 2;
+    stats.ops[LLIST_STATS_GET].latency[4] = 1;
+    llist__stats_dump(&stats, stdout);
+    fflush(stdout);
+
+    static const char * names[] = { "insert", "get", "remove", "delete", "find" };
+    char expected[4096] = "{\"nallocs\": 3, \"nfrees\": 1, \"ops\": {";
+    for (size_t op = 0; op < LLIST_STATS_NOPS; op++) {
+        char head[128];
+        snprintf(head, sizeof(head), "%s\"%s\": {\"count\": %llu, \"nodes\": %llu, \"latency_ns_log2\": ",
+                 op == 0 ? "" : ", ", names[op], (unsigned long long) stats.ops[op].count,
+                 (unsigned long long) stats.ops[op].nodes);
+        strcat(expected, head);
+        append_histogram(expected, stats.ops[op].latency);
+        strcat(expected, "}");
+    }
+    strcat(expected, "}}\n");
+    cr_assert_stdout_eq_str(expected);
+}
@@ -0,0 +1,22 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+
+Test(llist__stats_reset, list_and_totals) {
+    int item = 0;
+    LinkedList * lst = llist__create();
+    llist__append(lst, (void *) &item);
+    llist__stats_reset(lst);
+    llist__Stats stats;
+    llist__stats(lst, &stats);
+    cr_assert(stats.ops[LLIST_STATS_INSERT].count == 0 && stats.nallocs == 0,
+              "Expected the counters of the list to be reset.\n");
+    llist__append(lst, (void *) &item);
+    llist__stats_reset(NULL);
+    llist__stats(NULL, &stats);
+    cr_assert(stats.ops[LLIST_STATS_INSERT].count == 0, "Expected the totals to be reset.\n");
+    llist__stats(lst, &stats);
+#ifdef LLIST_STATS
+    cr_assert(stats.ops[LLIST_STATS_INSERT].count == 1, "Expected resetting the totals to leave the list alone.\n");
+#endif
+    llist__destroy(&lst);
+}
@@ -0,0 +1,38 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nbytes;
+} Budget;
+
+static void * budget_alloc (size_t size, void * ctx) {
+    Budget * budget = ctx;
+    if (budget->nallocs == 0) return NULL;
+    budget->nallocs--;
+    budget->nbytes += size;
+    return malloc(size);
+}
+
+static void budget_free (void * p, size_t size, void * ctx) {
+    Budget * budget = ctx;
+    budget->nbytes -= size;
+    free(p);
+}
+
+Test(llist__try_append, until_out_of_memory) {
+    int arr[] = { 100, 101, 102 };
+    Budget budget = { .nallocs = 3, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = llist__try_create(&allocator);
+    cr_assert(llist__try_append(lst, (void *) &arr[0]), "Expected the first append to succeed.\n");
+    cr_assert(llist__try_append(lst, (void *) &arr[1]), "Expected the second append to succeed.\n");
+    errno = 0;
+    cr_assert(!llist__try_append(lst, (void *) &arr[2]), "Expected the third append to fail.\n");
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+    cr_assert(llist__pop_back(lst) == &arr[1], "Expected 101 to be the last item.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned.\n");
+}
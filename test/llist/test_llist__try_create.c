@@ -0,0 +1,59 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nbytes;
+} Budget;
+
+static void * budget_alloc (size_t size, void * ctx) {
+    Budget * budget = ctx;
+    if (budget->nallocs == 0) return NULL;
+    budget->nallocs--;
+    budget->nbytes += size;
+    return malloc(size);
+}
+
+static void budget_free (void * p, size_t size, void * ctx) {
+    Budget * budget = ctx;
+    budget->nbytes -= size;
+    free(p);
+}
+
+Test(llist__try_create, default_allocator) {
+    LinkedList * lst = llist__try_create(NULL);
+    cr_assert(lst != NULL, "Expected a linked list.\n");
+    cr_assert(llist__try_append(lst, NULL), "Expected the append to succeed.\n");
+    llist__destroy(&lst);
+}
+
+Test(llist__try_create, out_of_memory) {
+    Budget budget = { .nallocs = 0, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    errno = 0;
+    LinkedList * lst = llist__try_create(&allocator);
+    cr_assert(lst == NULL, "Expected no linked list without memory.\n");
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+}
+
+Test(llist__try_create, returns_all_memory) {
+    // the list, its nodes and the tail of a split all come from the budget
+    int arr[] = { 100, 101, 102, 103 };
+    Budget budget = { .nallocs = 100, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = llist__try_create(&allocator);
+    cr_assert(lst != NULL, "Expected a linked list.\n");
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    cr_assert(budget.nallocs == 95, "Expected 5 allocations but counted %zu.\n", 100 - budget.nallocs);
+    LinkedList * tail = llist__split(lst, 2);
+    llist__pop_front(lst);
+    llist__splice(lst, 1, tail);
+    cr_assert(llist__get(2, lst) == &arr[3], "Expected the spliced list to end with 103.\n");
+    llist__destroy(&tail);
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
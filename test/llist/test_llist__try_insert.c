@@ -0,0 +1,153 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nbytes;
+    size_t maxbytes;
+} Budget;
+
+static void * budget_alloc (size_t size, void * ctx) {
+    Budget * budget = ctx;
+    if (budget->nallocs == 0) return NULL;
+    if (budget->maxbytes > 0 && budget->nbytes + size > budget->maxbytes) return NULL;
+    budget->nallocs--;
+    budget->nbytes += size;
+    return malloc(size);
+}
+
+static void budget_free (void * p, size_t size, void * ctx) {
+    Budget * budget = ctx;
+    budget->nbytes -= size;
+    free(p);
+}
+
+static Budget budget = { .nallocs = 0, .nbytes = 0 };
+
+static LinkedList * lst = NULL;
+
+static void setup (void) {
+    // the list itself takes one allocation
+    budget.nallocs = 4;
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    lst = llist__try_create(&allocator);
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+}
+
+Test(llist__try_insert, until_out_of_memory, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    cr_assert(llist__try_insert(0, (void *) &arr[0], lst), "Expected the first insert to succeed.\n");
+    cr_assert(llist__try_insert(1, (void *) &arr[2], lst), "Expected the second insert to succeed.\n");
+    cr_assert(llist__try_insert(1, (void *) &arr[1], lst), "Expected the third insert to succeed.\n");
+    errno = 0;
+    cr_assert(!llist__try_insert(1, (void *) &arr[3], lst), "Expected the fourth insert to fail.\n");
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+    cr_assert(llist__get_length(lst) == 3, "Expected the failed insert to leave the list as it was.\n");
+    for (size_t i = 0; i < 3; i++) {
+        cr_assert(llist__get(i, lst) == &arr[i], "Expected item %zu to be in place.\n", i);
+    }
+}
+
+Test(llist__try_insert, reuses_freed_memory, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    for (size_t i = 0; i < 3; i++) {
+        cr_assert(llist__try_insert(i, (void *) &arr[i], lst), "Expected insert %zu to succeed.\n", i);
+    }
+    llist__remove(1, lst);
+    budget.nallocs++;
+    cr_assert(llist__try_insert(1, (void *) &arr[3], lst), "Expected an insert after a removal to succeed.\n");
+    cr_assert(llist__get(1, lst) == &arr[3], "Expected 103 at position 1.\n");
+}
+
+Test(llist__try_insert, pooled) {
+    // the pool hands out nodes from its slab until it needs another one
+    int arr[] = { 100, 101 };
+    llist__NodePool * pool = llist__pool_create(1);
+    LinkedList * pooled = llist__create_with_pool(pool);
+    cr_assert(llist__try_insert(0, (void *) &arr[0], pooled), "Expected the insert to succeed.\n");
+    cr_assert(llist__try_insert(0, (void *) &arr[1], pooled), "Expected the insert to succeed.\n");
+    cr_assert(llist__get(0, pooled) == &arr[1], "Expected 101 to come first.\n");
+    llist__destroy(&pooled);
+    llist__pool_destroy(&pool);
+}
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+Test(llist__try_insert, indexed_and_keyed) {
+    // the keyed index grows several times, and the index takes every insert
+    static int arr[300];
+    int * expected[300];
+    LinkedList * other = llist__create();
+    llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+    llist__set_keyed(other, &ops);
+    llist__set_indexed(other, true);
+    for (size_t i = 0; i < 300; i++) {
+        arr[i] = (int) i;
+        for (size_t j = i; j > i / 2; j--) {
+            expected[j] = expected[j - 1];
+        }
+        expected[i / 2] = &arr[i];
+        cr_assert(llist__try_insert(i / 2, (void *) &arr[i], other), "Expected insert %zu to succeed.\n", i);
+    }
+    for (int key = 0; key < 300; key++) {
+        cr_assert(llist__find(other, &key) == &arr[key], "Expected to find key %d.\n", key);
+    }
+    for (size_t i = 0; i < 300; i++) {
+        cr_assert(llist__get(i, other) == expected[i], "Expected item %zu to be in its inserted position.\n", i);
+    }
+    llist__destroy(&other);
+}
+
+Test(llist__try_insert, stale_index) {
+    // splicing leaves the index stale; inserting walks instead of rebuilding
+    int arr[] = { 100, 101, 102, 103 };
+    LinkedList * other = llist__create();
+    LinkedList * src = llist__create();
+    llist__set_indexed(other, true);
+    llist__append(other, (void *) &arr[0]);
+    llist__append(src, (void *) &arr[1]);
+    llist__append(src, (void *) &arr[3]);
+    llist__splice(other, 1, src);
+    cr_assert(llist__try_insert(2, (void *) &arr[2], other), "Expected the insert to succeed.\n");
+    for (size_t i = 0; i < 4; i++) {
+        cr_assert(llist__get(i, other) == &arr[i], "Expected item %zu to be in place.\n", i);
+    }
+    llist__destroy(&src);
+    llist__destroy(&other);
+}
+
+Test(llist__try_insert, shared_budget) {
+    // deleting from one list makes room for inserting into another
+    int item = 0;
+    Budget shared = { .nallocs = SIZE_MAX, .nbytes = 0, .maxbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &shared };
+    LinkedList * a = llist__try_create(&allocator);
+    LinkedList * b = llist__try_create(&allocator);
+    while (llist__try_append(a, (void *) &item)) {
+        if (llist__get_length(a) == 100) {
+            shared.maxbytes = shared.nbytes;
+        }
+    }
+    cr_assert(llist__get_length(a) == 100, "Expected the budget to be used up.\n");
+    for (size_t i = 0; i < 10; i++) {
+        llist__pop_front(a);
+    }
+    for (size_t i = 0; i < 10; i++) {
+        cr_assert(llist__try_append(b, (void *) &item), "Expected the freed nodes to make room for item %zu.\n", i);
+    }
+    cr_assert(!llist__try_append(b, (void *) &item), "Expected the budget to be used up again.\n");
+    llist__destroy(&a);
+    llist__destroy(&b);
+    cr_assert(shared.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", shared.nbytes);
+}
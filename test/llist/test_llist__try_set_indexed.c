@@ -0,0 +1,64 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nbytes;
+} Budget;
+
+static int items[100];
+
+static void * budget_alloc (size_t size, void * ctx) {
+    Budget * budget = ctx;
+    if (budget->nallocs == 0) return NULL;
+    budget->nallocs--;
+    budget->nbytes += size;
+    return malloc(size);
+}
+
+static void budget_free (void * p, size_t size, void * ctx) {
+    Budget * budget = ctx;
+    budget->nbytes -= size;
+    free(p);
+}
+
+static LinkedList * create_filled (llist__Allocator * allocator) {
+    LinkedList * lst = llist__try_create(allocator);
+    for (size_t i = 0; i < 100; i++) {
+        items[i] = (int) i;
+        llist__append(lst, (void *) &items[i]);
+    }
+    return lst;
+}
+
+Test(llist__try_set_indexed, from_budget) {
+    Budget budget = { .nallocs = SIZE_MAX, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = create_filled(&allocator);
+    size_t nbytes = budget.nbytes;
+    cr_assert(llist__try_set_indexed(lst, true), "Expected the index to be built.\n");
+    cr_assert(budget.nbytes > nbytes, "Expected the index to draw from the budget.\n");
+    cr_assert(llist__get(42, lst) == &items[42], "Expected the index to find item 42.\n");
+    cr_assert(llist__try_set_indexed(lst, false), "Expected the index to be switched off.\n");
+    cr_assert(budget.nbytes == nbytes, "Expected the index to return its memory.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
+
+Test(llist__try_set_indexed, out_of_memory) {
+    // run out halfway through building the lanes
+    Budget budget = { .nallocs = SIZE_MAX, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = create_filled(&allocator);
+    size_t nbytes = budget.nbytes;
+    budget.nallocs = 10;
+    errno = 0;
+    cr_assert(!llist__try_set_indexed(lst, true), "Expected the index not to fit the budget.\n");
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+    cr_assert(budget.nbytes == nbytes, "Expected the partial index to be freed.\n");
+    cr_assert(llist__get(42, lst) == &items[42], "Expected the list to remain usable.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
@@ -0,0 +1,74 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nbytes;
+} Budget;
+
+static int items[100];
+
+static void * budget_alloc (size_t size, void * ctx) {
+    Budget * budget = ctx;
+    if (budget->nallocs == 0) return NULL;
+    budget->nallocs--;
+    budget->nbytes += size;
+    return malloc(size);
+}
+
+static void budget_free (void * p, size_t size, void * ctx) {
+    Budget * budget = ctx;
+    budget->nbytes -= size;
+    free(p);
+}
+
+static uint64_t hash_int (const void * key, void *) {
+    return (uint64_t) *((const int *) key);
+}
+
+static bool equal_ints (const void * a, const void * b, void *) {
+    return *((const int *) a) == *((const int *) b);
+}
+
+static llist__KeyOps ops = { .key = NULL, .hash = hash_int, .equal = equal_ints };
+
+static LinkedList * create_filled (llist__Allocator * allocator) {
+    LinkedList * lst = llist__try_create(allocator);
+    for (size_t i = 0; i < 100; i++) {
+        items[i] = (int) i;
+        llist__append(lst, (void *) &items[i]);
+    }
+    return lst;
+}
+
+Test(llist__try_set_keyed, from_budget) {
+    Budget budget = { .nallocs = SIZE_MAX, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = create_filled(&allocator);
+    size_t nbytes = budget.nbytes;
+    cr_assert(llist__try_set_keyed(lst, &ops), "Expected the keyed index to be built.\n");
+    cr_assert(budget.nbytes > nbytes, "Expected the keyed index to draw from the budget.\n");
+    cr_assert(llist__find(lst, &items[42]) == &items[42], "Expected the keys to find item 42.\n");
+    cr_assert(llist__try_set_keyed(lst, NULL), "Expected the keyed index to be switched off.\n");
+    cr_assert(budget.nbytes == nbytes, "Expected the keyed index to return its memory.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
+
+Test(llist__try_set_keyed, out_of_memory) {
+    Budget budget = { .nallocs = SIZE_MAX, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = create_filled(&allocator);
+    cr_assert(llist__try_set_keyed(lst, &ops), "Expected the keyed index to be built.\n");
+    size_t nbytes = budget.nbytes;
+    budget.nallocs = 1;
+    errno = 0;
+    cr_assert(!llist__try_set_keyed(lst, &ops), "Expected the new table not to fit the budget.\n");
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+    cr_assert(budget.nbytes == nbytes, "Expected the partial table to be freed.\n");
+    cr_assert(llist__find(lst, &items[42]) == &items[42], "Expected the old keyed index to remain.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
@@ -0,0 +1,70 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t nallocs;
+    size_t nbytes;
+} Budget;
+
+static int items[100];
+
+static void * budget_alloc (size_t size, void * ctx) {
+    Budget * budget = ctx;
+    if (budget->nallocs == 0) return NULL;
+    budget->nallocs--;
+    budget->nbytes += size;
+    return malloc(size);
+}
+
+static void budget_free (void * p, size_t size, void * ctx) {
+    Budget * budget = ctx;
+    budget->nbytes -= size;
+    free(p);
+}
+
+static bool is_odd (void * p) {
+    return *((int *) p) % 2 != 0;
+}
+
+static bool is_negative (void * p) {
+    return *((int *) p) < 0;
+}
+
+static LinkedList * create_filled (llist__Allocator * allocator) {
+    LinkedList * lst = llist__try_create(allocator);
+    for (size_t i = 0; i < 100; i++) {
+        items[i] = (int) i;
+        llist__append(lst, (void *) &items[i]);
+    }
+    return lst;
+}
+
+Test(llist__try_set_prefetch, from_budget) {
+    Budget budget = { .nallocs = SIZE_MAX, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = create_filled(&allocator);
+    size_t nbytes = budget.nbytes;
+    cr_assert(llist__try_set_prefetch(lst, 8, true), "Expected prefetching to be switched on.\n");
+    llist__delete(true, lst, is_negative);
+    cr_assert(budget.nbytes > nbytes, "Expected the recorded addresses to draw from the budget.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
+
+Test(llist__try_set_prefetch, out_of_memory) {
+    Budget budget = { .nallocs = SIZE_MAX, .nbytes = 0 };
+    llist__Allocator allocator = { .alloc = budget_alloc, .free = budget_free, .ctx = &budget };
+    LinkedList * lst = create_filled(&allocator);
+    budget.nallocs = 0;
+    errno = 0;
+    cr_assert(!llist__try_set_prefetch(lst, 8, true), "Expected prefetching not to fit the budget.\n");
+    cr_assert(errno == ENOMEM, "Expected errno to be ENOMEM.\n");
+    budget.nallocs = 1;
+    cr_assert(llist__try_set_prefetch(lst, 8, true), "Expected prefetching to be switched on.\n");
+    llist__delete(true, lst, is_odd);
+    cr_assert(llist__get_length(lst) == 50, "Expected traversals to go on without recording.\n");
+    llist__destroy(&lst);
+    cr_assert(budget.nbytes == 0, "Expected all memory to be returned but %zu bytes remain.\n", budget.nbytes);
+}
@@ -0,0 +1,148 @@
+#include "llist/llist.h"
+#include <criterion/criterion.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static LinkedList * lst = NULL;
+
+static FILE * out = NULL;
+
+static void setup (void) {
+    lst = llist__create();
+    out = tmpfile();
+}
+
+static void teardown (void) {
+    llist__destroy(&lst);
+    fclose(out);
+}
+
+static size_t slurp (char * buf, size_t size) {
+    rewind(out);
+    return fread(buf, 1, size, out);
+}
+
+static size_t format_hex (char * buf, size_t avail, const void * p) {
+    return (size_t) snprintf(buf, avail, "<%x>", (unsigned int) *((const int *) p));
+}
+
+Test(llist__write, empty, .init = setup, .fini = teardown) {
+    char actual[16] = { 0 };
+    cr_assert(llist__write(lst, NULL, fileno(out)), "Expected writing to succeed.\n");
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, "[]\n") == 0, "Expected an empty list to be written as brackets only.\n");
+}
+
+Test(llist__write, ints, .init = setup, .fini = teardown) {
+    int arr[] = { 100, -101, 0, 2147483647, -2147483647 - 1 };
+    for (size_t i = 0; i < 5; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__WriteOptions opts = { .format = LLIST_FORMAT_INT };
+    char actual[64] = { 0 };
+    cr_assert(llist__write(lst, &opts, fileno(out)), "Expected writing to succeed.\n");
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, "[100, -101, 0, 2147483647, -2147483648]\n") == 0, "Got '%s'.\n", actual);
+}
+
+Test(llist__write, floats, .init = setup, .fini = teardown) {
+    float arr[] = { 200.0f, 0.1f, -2.5f, 9.999f };
+    for (size_t i = 0; i < 4; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__WriteOptions opts = { .format = LLIST_FORMAT_FLOAT, .precision = 2 };
+    char actual[64] = { 0 };
+    cr_assert(llist__write(lst, &opts, fileno(out)), "Expected writing to succeed.\n");
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, "[200.00, 0.10, -2.50, 10.00]\n") == 0, "Got '%s'.\n", actual);
+}
+
+Test(llist__write, doubles, .init = setup, .fini = teardown) {
+    double arr[] = { 1e20, 3.0, 0.5, 1.5, -0.0 };
+    for (size_t i = 0; i < 5; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__WriteOptions opts = { .format = LLIST_FORMAT_DOUBLE };
+    char actual[64] = { 0 };
+    cr_assert(llist__write(lst, &opts, fileno(out)), "Expected writing to succeed.\n");
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, "[1e+20, 3, 0, 2, -0]\n") == 0, "Got '%s'.\n", actual);
+}
+
+Test(llist__write, pointers, .init = setup, .fini = teardown) {
+    llist__append(lst, (void *) (uintptr_t) 0xdeadbeef);
+    llist__append(lst, NULL);
+    char actual[32] = { 0 };
+    cr_assert(llist__write(lst, NULL, fileno(out)), "Expected writing to succeed.\n");
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, "[0xdeadbeef, 0x0]\n") == 0, "Got '%s'.\n", actual);
+}
+
+Test(llist__write, binary, .init = setup, .fini = teardown) {
+    int arr[] = { 1, -2, 3 };
+    for (size_t i = 0; i < 3; i++) {
+        llist__append(lst, (void *) &arr[i]);
+    }
+    llist__WriteOptions opts = { .format = LLIST_FORMAT_INT, .binary = true };
+    cr_assert(llist__write(lst, &opts, fileno(out)), "Expected writing to succeed.\n");
+    unsigned char actual[64];
+    size_t n = slurp((char *) actual, sizeof(actual));
+    cr_assert(n == sizeof(uint64_t) + 3 * sizeof(int), "Expected a count followed by the raw ints.\n");
+    uint64_t nelems = 0;
+    int values[3] = { 0 };
+    memcpy(&nelems, actual, sizeof(nelems));
+    memcpy(values, actual + sizeof(nelems), sizeof(values));
+    cr_assert(nelems == 3 && values[0] == 1 && values[1] == -2 && values[2] == 3, "Expected the ints back.\n");
+}
+
+Test(llist__write, custom_elem_small_buffer, .init = setup, .fini = teardown) {
+    // a 64 byte buffer holds a handful of items, so this takes many flushes
+    static int arr[100];
+    for (int i = 0; i < 100; i++) {
+        arr[i] = i;
+        llist__append(lst, (void *) &arr[i]);
+    }
+    char buffer[64];
+    llist__WriteOptions opts = { .elem = format_hex, .buffer = buffer, .bufsize = sizeof(buffer) };
+    cr_assert(llist__write(lst, &opts, fileno(out)), "Expected writing to succeed.\n");
+
+    char expected[1024] = "[";
+    for (int i = 0; i < 100; i++) {
+        char item[16];
+        snprintf(item, sizeof(item), "<%x>%s", (unsigned int) i, i < 99 ? ", " : "]\n");
+        strcat(expected, item);
+    }
+    char actual[1024] = { 0 };
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, expected) == 0, "Got '%s'.\n", actual);
+}
+
+static size_t format_wide (char * buf, size_t avail, const void * p) {
+    // 100 characters per item, more than the 64 byte buffer can hold
+    return (size_t) snprintf(buf, avail, "%0100d", *((const int *) p));
+}
+
+Test(llist__write, custom_elem_larger_than_buffer, .init = setup, .fini = teardown) {
+    int arr[] = { 7, 8 };
+    llist__append(lst, (void *) &arr[0]);
+    llist__append(lst, (void *) &arr[1]);
+    char buffer[64];
+    llist__WriteOptions opts = { .elem = format_wide, .buffer = buffer, .bufsize = sizeof(buffer) };
+    cr_assert(llist__write(lst, &opts, fileno(out)), "Expected writing to succeed.\n");
+
+    char expected[256];
+    snprintf(expected, sizeof(expected), "[%0100d, %0100d]\n", 7, 8);
+    char actual[256] = { 0 };
+    slurp(actual, sizeof(actual) - 1);
+    cr_assert(strcmp(actual, expected) == 0, "Got '%s'.\n", actual);
+}
+
+Test(llist__write, bad_fd, .init = setup, .fini = teardown) {
+    int item = 1;
+    llist__append(lst, (void *) &item);
+    errno = 0;
+    cr_assert(!llist__write(lst, NULL, -1), "Expected writing to a bad file descriptor to fail.\n");
+    cr_assert(errno == EBADF, "Expected errno to say why.\n");
+}
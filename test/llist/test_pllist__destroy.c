@@ -0,0 +1,54 @@
+#include "llist/pllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int items[] = { 100, 101, 102, 103 };
+
+static PersistentList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    // build [100, 101, 102, 103]
+    PersistentList * v = pllist__create();
+    for (size_t i = 4; i > 0; i--) {
+        PersistentList * next = pllist__prepend(v, (void *) &items[i - 1]);
+        pllist__destroy(&v);
+        v = next;
+    }
+    lst = v;
+}
+
+static void teardown (void) {
+    pllist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *(int *) elem);
+    } else {
+        fprintf(fd, "%d", *(int *) elem);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(pllist__destroy, oldest_version_first, .init = setup, .fini = teardown) {
+    PersistentList * rest = pllist__pop_front(lst, NULL);
+    pllist__destroy(&lst);
+    cr_assert(lst == NULL, "Expected the pointer to be reset.\n");
+    lst = rest;
+    pllist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n");
+}
+
+Test(pllist__destroy, newest_version_first, .init = setup, .fini = teardown) {
+    PersistentList * rest = pllist__pop_front(lst, NULL);
+    pllist__destroy(&rest);
+    cr_assert(rest == NULL, "Expected the pointer to be reset.\n");
+    pllist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
@@ -0,0 +1,35 @@
+#include "llist/pllist.h"
+#include <criterion/criterion.h>
+
+static int items[] = { 100, 101, 102, 103 };
+
+static PersistentList * lst = NULL;
+
+static void setup (void) {
+    // build [100, 101, 102, 103]
+    PersistentList * v = pllist__create();
+    for (size_t i = 4; i > 0; i--) {
+        PersistentList * next = pllist__prepend(v, (void *) &items[i - 1]);
+        pllist__destroy(&v);
+        v = next;
+    }
+    lst = v;
+}
+
+static void teardown (void) {
+    pllist__destroy(&lst);
+}
+
+Test(pllist__get, each_position, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 4; i++) {
+        cr_assert(pllist__get(i, lst) == &items[i], "Expected item %zu to be returned.\n", i);
+    }
+    cr_assert(pllist__first(lst) == &items[0], "Expected the first item to be returned.\n");
+}
+
+Test(pllist__get, after_pop_front, .init = setup, .fini = teardown) {
+    PersistentList * rest = pllist__pop_front(lst, NULL);
+    cr_assert(pllist__get(0, rest) == &items[1], "Expected the second item to come first.\n");
+    cr_assert(pllist__get(2, rest) == &items[3], "Expected the last item to come last.\n");
+    pllist__destroy(&rest);
+}
@@ -0,0 +1,52 @@
+#include "llist/pllist.h"
+#include <criterion/criterion.h>
+
+static int items[] = { 100, 101, 102, 103 };
+
+static PersistentList * lst = NULL;
+
+static void setup (void) {
+    // build [100, 101, 102, 103]
+    PersistentList * v = pllist__create();
+    for (size_t i = 4; i > 0; i--) {
+        PersistentList * next = pllist__prepend(v, (void *) &items[i - 1]);
+        pllist__destroy(&v);
+        v = next;
+    }
+    lst = v;
+}
+
+static void teardown (void) {
+    pllist__destroy(&lst);
+}
+
+Test(pllist__iter_next, visits_all_items, .init = setup, .fini = teardown) {
+    pllist__Iter it = pllist__iter_begin(lst);
+    size_t i = 0;
+    while (pllist__iter_next(&it)) {
+        cr_assert(pllist__iter_get(&it) == &items[i], "Expected item %zu to be visited.\n", i);
+        i++;
+    }
+    cr_assert(i == 4, "Expected all items to be visited.\n");
+}
+
+Test(pllist__iter_next, survives_newer_versions, .init = setup, .fini = teardown) {
+    pllist__Iter it = pllist__iter_begin(lst);
+    pllist__iter_next(&it);
+    PersistentList * rest = pllist__pop_front(lst, NULL);
+    PersistentList * other = pllist__prepend(rest, (void *) &items[3]);
+    pllist__destroy(&rest);
+    pllist__destroy(&other);
+    size_t n = 1;
+    while (pllist__iter_next(&it)) {
+        n++;
+    }
+    cr_assert(n == 4, "Expected the cursor to visit the version it started on.\n");
+}
+
+Test(pllist__iter_next, empty) {
+    PersistentList * empty = pllist__create();
+    pllist__Iter it = pllist__iter_begin(empty);
+    cr_assert(!pllist__iter_next(&it), "Expected no items to be visited.\n");
+    pllist__destroy(&empty);
+}
@@ -0,0 +1,61 @@
+#include "llist/pllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int items[] = { 100, 101, 102, 103 };
+
+static PersistentList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    // build [100, 101, 102, 103]
+    PersistentList * v = pllist__create();
+    for (size_t i = 4; i > 0; i--) {
+        PersistentList * next = pllist__prepend(v, (void *) &items[i - 1]);
+        pllist__destroy(&v);
+        v = next;
+    }
+    lst = v;
+}
+
+static void teardown (void) {
+    pllist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *(int *) elem);
+    } else {
+        fprintf(fd, "%d", *(int *) elem);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(pllist__pop_front, one_item, .init = setup, .fini = teardown) {
+    void * item = NULL;
+    PersistentList * rest = pllist__pop_front(lst, &item);
+    cr_assert(item == &items[0], "Expected the first item to be returned.\n");
+    pllist__print(rest, &printers, stdout);
+    pllist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n[100, 101, 102, 103]\n");
+    pllist__destroy(&rest);
+}
+
+Test(pllist__pop_front, all_items_then_prepend, .init = setup, .fini = teardown) {
+    for (size_t i = 0; i < 4; i++) {
+        PersistentList * rest = pllist__pop_front(lst, NULL);
+        pllist__destroy(&lst);
+        lst = rest;
+    }
+    cr_assert(pllist__get_length(lst) == 0, "Expected the list to be empty.\n");
+    PersistentList * one = pllist__prepend(lst, (void *) &items[2]);
+    pllist__destroy(&lst);
+    lst = one;
+    pllist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[102]\n");
+}
@@ -0,0 +1,69 @@
+#include "llist/pllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int items[] = { 100, 101, 102, 103 };
+
+static PersistentList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    // build [100, 101, 102, 103]
+    PersistentList * v = pllist__create();
+    for (size_t i = 4; i > 0; i--) {
+        PersistentList * next = pllist__prepend(v, (void *) &items[i - 1]);
+        pllist__destroy(&v);
+        v = next;
+    }
+    lst = v;
+}
+
+static void teardown (void) {
+    pllist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *(int *) elem);
+    } else {
+        fprintf(fd, "%d", *(int *) elem);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(pllist__prepend, to_empty) {
+    PersistentList * empty = pllist__create();
+    PersistentList * one = pllist__prepend(empty, (void *) &items[0]);
+    cr_assert(pllist__get_length(empty) == 0, "Expected the original version to remain empty.\n");
+    cr_assert(pllist__get_length(one) == 1, "Expected the new version to hold one item.\n");
+    cr_assert(pllist__first(one) == &items[0], "Expected the prepended item to come first.\n");
+    pllist__destroy(&empty);
+    pllist__destroy(&one);
+}
+
+Test(pllist__prepend, leaves_the_original_intact, .init = setup, .fini = teardown) {
+    static int extra = 99;
+    PersistentList * longer = pllist__prepend(lst, (void *) &extra);
+    pllist__print(longer, &printers, stdout);
+    pllist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[99, 100, 101, 102, 103]\n[100, 101, 102, 103]\n");
+    pllist__destroy(&longer);
+}
+
+Test(pllist__prepend, branches_share_the_tail, .init = setup, .fini = teardown) {
+    static int a = 1;
+    static int b = 2;
+    PersistentList * left = pllist__prepend(lst, (void *) &a);
+    PersistentList * right = pllist__prepend(lst, (void *) &b);
+    pllist__destroy(&lst);
+    pllist__print(left, &printers, stdout);
+    pllist__destroy(&left);
+    pllist__print(right, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[1, 100, 101, 102, 103]\n[2, 100, 101, 102, 103]\n");
+    lst = right;
+}
@@ -0,0 +1,80 @@
+#include "llist/cllist.h"
+#include "llist/pllist.h"
+#include <criterion/criterion.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#define NTHREADS 4
+
+#define NVERSIONS 20000
+
+static size_t values[NVERSIONS];
+
+static ConcurrentQueue * q = NULL;
+
+static atomic_size_t nchecked = 0;
+
+static atomic_bool consistent = true;
+
+static int reader (void *) {
+    while (atomic_load(&nchecked) < NVERSIONS) {
+        PersistentList * version = NULL;
+        if (!cllist__queue_pop_front(q, (void **) &version)) continue;
+        // the writer only prepends ever larger values, so every version
+        // must be strictly decreasing and as long as it claims to be
+        pllist__Iter it = pllist__iter_begin(version);
+        size_t n = 0;
+        size_t prev = SIZE_MAX;
+        while (pllist__iter_next(&it)) {
+            size_t value = *(size_t *) pllist__iter_get(&it);
+            if (value >= prev) {
+                atomic_store(&consistent, false);
+            }
+            prev = value;
+            n++;
+        }
+        if (n != pllist__get_length(version)) {
+            atomic_store(&consistent, false);
+        }
+        pllist__destroy(&version);
+        atomic_fetch_add(&nchecked, 1);
+    }
+    return 0;
+}
+
+Test(pllist__snapshot, same_version) {
+    PersistentList * lst = pllist__create();
+    PersistentList * snapshot = pllist__snapshot(lst);
+    cr_assert(snapshot == lst, "Expected a snapshot not to copy the version.\n");
+    pllist__destroy(&lst);
+    cr_assert(pllist__get_length(snapshot) == 0, "Expected the snapshot to outlive the original.\n");
+    pllist__destroy(&snapshot);
+}
+
+Test(pllist__snapshot, readers_while_writing) {
+    q = cllist__queue_create();
+    thrd_t readers[NTHREADS];
+    for (size_t t = 0; t < NTHREADS; t++) {
+        thrd_create(&readers[t], reader, NULL);
+    }
+    PersistentList * current = pllist__create();
+    for (size_t i = 0; i < NVERSIONS; i++) {
+        values[i] = i;
+        PersistentList * next = NULL;
+        if (i % 3 == 2) {
+            next = pllist__pop_front(current, NULL);
+        } else {
+            next = pllist__prepend(current, (void *) &values[i]);
+        }
+        pllist__destroy(&current);
+        current = next;
+        cllist__queue_append(q, pllist__snapshot(current));
+    }
+    for (size_t t = 0; t < NTHREADS; t++) {
+        thrd_join(readers[t], NULL);
+    }
+    cr_assert(atomic_load(&consistent), "Expected every reader to see a consistent version.\n");
+    cr_assert(pllist__get_length(current) == NVERSIONS - 2 * (NVERSIONS / 3), "Expected the writer's version to hold the remaining items.\n");
+    pllist__destroy(&current);
+    cllist__queue_destroy(&q);
+}
@@ -0,0 +1,52 @@
+#include "llist/tllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+LLIST_DEFINE(ilist, int)
+
+static ilist * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ilist__create();
+    ilist__append(lst, 100);
+    ilist__append(lst, 101);
+    ilist__append(lst, 102);
+    ilist__append(lst, 103);
+}
+
+static void teardown (void) {
+    ilist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(tllist__append, to_empty) {
+    cr_redirect_stdout();
+    ilist * empty = ilist__create();
+    ilist__append(empty, 7);
+    cr_assert(ilist__get_length(empty) == 1, "Expected the list to hold one item.\n");
+    ilist__print(empty, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[7]\n");
+    ilist__destroy(&empty);
+}
+
+Test(tllist__append, stores_a_copy, .init = setup, .fini = teardown) {
+    int item = 104;
+    ilist__append(lst, item);
+    item = 0;
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 104]\n");
+}
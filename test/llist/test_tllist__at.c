@@ -0,0 +1,58 @@
+#include "llist/tllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+LLIST_DEFINE(ilist, int)
+
+static ilist * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ilist__create();
+    ilist__append(lst, 100);
+    ilist__append(lst, 101);
+    ilist__append(lst, 102);
+    ilist__append(lst, 103);
+}
+
+static void teardown (void) {
+    ilist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+typedef struct {
+    int id;
+    float progress;
+} Task;
+
+LLIST_DEFINE(tlist, Task)
+
+Test(tllist__at, points_into_the_node, .init = setup, .fini = teardown) {
+    int * p = ilist__at(2, lst);
+    cr_assert(*p == 102, "Expected a pointer to the third item.\n");
+    *p = 202;
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 202, 103]\n");
+}
+
+Test(tllist__at, struct_payload) {
+    tlist * tasks = tlist__create();
+    tlist__append(tasks, (Task) { .id = 1, .progress = 0.5f });
+    tlist__append(tasks, (Task) { .id = 2, .progress = 0.25f });
+    tlist__at(1, tasks)->progress = 1.0f;
+    cr_assert(tlist__get(0, tasks).id == 1, "Expected the first task to have id 1.\n");
+    cr_assert(tlist__get(1, tasks).progress == 1.0f, "Expected the second task to be updated in place.\n");
+    tlist__destroy(&tasks);
+}
@@ -0,0 +1,59 @@
+#include "llist/tllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+LLIST_DEFINE(ilist, int)
+
+static ilist * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ilist__create();
+    ilist__append(lst, 100);
+    ilist__append(lst, 101);
+    ilist__append(lst, 102);
+    ilist__append(lst, 103);
+}
+
+static void teardown (void) {
+    ilist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool filter (const int * elem) {
+    return *elem > 100;
+}
+
+Test(tllist__delete, first, .init = setup, .fini = teardown) {
+    ilist__delete(false, lst, filter);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 102, 103]\n");
+}
+
+Test(tllist__delete, global, .init = setup, .fini = teardown) {
+    ilist__delete(true, lst, filter);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100]\n");
+}
+
+Test(tllist__delete, last_then_append, .init = setup, .fini = teardown) {
+    ilist__delete(true, lst, filter);
+    ilist__delete(true, lst, filter);
+    ilist__append(lst, 104);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 104]\n");
+}
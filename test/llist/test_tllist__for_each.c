@@ -0,0 +1,44 @@
+#include "llist/tllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+LLIST_DEFINE(ilist, int)
+
+static ilist * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ilist__create();
+    ilist__append(lst, 100);
+    ilist__append(lst, 101);
+    ilist__append(lst, 102);
+    ilist__append(lst, 103);
+}
+
+static void teardown (void) {
+    ilist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static void add (int * elem, void * ctx) {
+    *elem += *((int *) ctx);
+}
+
+Test(tllist__for_each, updates_in_place, .init = setup, .fini = teardown) {
+    int delta = 10;
+    ilist__for_each(lst, add, &delta);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[110, 111, 112, 113]\n");
+}
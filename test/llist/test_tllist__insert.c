@@ -0,0 +1,54 @@
+#include "llist/tllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+LLIST_DEFINE(ilist, int)
+
+static ilist * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ilist__create();
+    ilist__append(lst, 100);
+    ilist__append(lst, 101);
+    ilist__append(lst, 102);
+    ilist__append(lst, 103);
+}
+
+static void teardown (void) {
+    ilist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(tllist__insert, front, .init = setup, .fini = teardown) {
+    ilist__insert(0, 99, lst);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[99, 100, 101, 102, 103]\n");
+}
+
+Test(tllist__insert, middle, .init = setup, .fini = teardown) {
+    ilist__insert(3, 99, lst);
+    ilist__insert(1, 98, lst);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 98, 101, 102, 99, 103]\n");
+}
+
+Test(tllist__insert, end, .init = setup, .fini = teardown) {
+    ilist__insert(4, 99, lst);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103, 99]\n");
+}
@@ -0,0 +1,50 @@
+#include "llist/tllist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+LLIST_DEFINE(ilist, int)
+
+static ilist * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ilist__create();
+    ilist__append(lst, 100);
+    ilist__append(lst, 101);
+    ilist__append(lst, 102);
+    ilist__append(lst, 103);
+}
+
+static void teardown (void) {
+    ilist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(tllist__pop_front, one_item, .init = setup, .fini = teardown) {
+    cr_assert(ilist__pop_front(lst) == 100, "Expected the first item to be returned.\n");
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n");
+}
+
+Test(tllist__pop_front, all_items_then_prepend, .init = setup, .fini = teardown) {
+    for (int expected = 100; expected <= 103; expected++) {
+        cr_assert(ilist__pop_front(lst) == expected, "Expected items to come out front to back.\n");
+    }
+    cr_assert(ilist__get_length(lst) == 0, "Expected the list to be empty after popping all items.\n");
+    ilist__prepend(lst, 1);
+    ilist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[1]\n");
+}
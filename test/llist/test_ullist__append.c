@@ -0,0 +1,50 @@
+#include "llist/ullist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static UnrolledList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ullist__create();
+}
+
+static void teardown (void) {
+    ullist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(ullist__append, four_items, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    ullist__append(lst, (void *) &arr[0]);
+    ullist__append(lst, (void *) &arr[1]);
+    ullist__append(lst, (void *) &arr[2]);
+    ullist__append(lst, (void *) &arr[3]);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
+
+Test(ullist__append, more_items_than_a_chunk, .init = setup, .fini = teardown) {
+    int arr[3 * ULLIST_CHUNK_CAPACITY];
+    constexpr size_t n = sizeof(arr) / sizeof(arr[0]);
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int) i;
+        ullist__append(lst, (void *) &arr[i]);
+    }
+    cr_assert(ullist__get_length(lst) == n, "Expected %zu items.\n", n);
+    for (size_t i = 0; i < n; i++) {
+        cr_assert(ullist__pop_front(lst) == &arr[i], "Expected item %zu to come out in order.\n", i);
+    }
+}
@@ -0,0 +1,112 @@
+#include "llist/ullist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+typedef struct {
+    bool marked;
+    int data;
+} MyStruct;
+
+static MyStruct arr[] = {
+    { .marked = false, .data = 100 },
+    { .marked = false, .data = 101 },
+    { .marked = false, .data = 102 },
+    { .marked = false, .data = 103 }
+};
+
+static UnrolledList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ullist__create();
+    ullist__prepend(lst, (void *) &arr[3]);
+    ullist__prepend(lst, (void *) &arr[2]);
+    ullist__prepend(lst, (void *) &arr[1]);
+    ullist__prepend(lst, (void *) &arr[0]);
+}
+
+static void teardown (void) {
+    ullist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    MyStruct my_struct = *((MyStruct *) elem);
+    if (idx < nelems - 1) {
+        fprintf(fd, "{.marked: %s, .data: %d}, ", my_struct.marked ? "true" : "false", my_struct.data);
+    } else {
+        fprintf(fd, "{.marked: %s, .data: %d}", my_struct.marked ? "true" : "false", my_struct.data);
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+static bool filter (void * p) {
+    MyStruct my_struct = *((MyStruct *) p);
+    return my_struct.data % 2 == 0;
+}
+
+Test(ullist__delete, global, .init = setup, .fini = teardown) {
+    ullist__delete(true, lst, filter);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[{.marked: false, .data: 101}, {.marked: false, .data: 103}]\n");
+}
+
+Test(ullist__delete, local, .init = setup, .fini = teardown) {
+    ullist__delete(false, lst, filter);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str(
+        "[{.marked: false, .data: 101}, {.marked: false, .data: 102}, {.marked: false, .data: 103}]\n");
+}
+
+Test(ullist__delete, last_then_append, .init = setup, .fini = teardown) {
+    MyStruct extra = { .marked = true, .data = 105 };
+    ullist__delete(false, lst, filter);
+    ullist__delete(false, lst, filter);
+    ullist__append(lst, (void *) &extra);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str(
+        "[{.marked: false, .data: 101}, {.marked: false, .data: 103}, {.marked: true, .data: 105}]\n");
+}
+
+static bool filter_int (void * p) {
+    return *((int *) p) % 3 != 0;
+}
+
+Test(ullist__delete, global_many_chunks, .init = setup, .fini = teardown) {
+    int ints[6 * ULLIST_CHUNK_CAPACITY];
+    constexpr size_t n = sizeof(ints) / sizeof(ints[0]);
+    UnrolledList * other = ullist__create();
+    for (size_t i = 0; i < n; i++) {
+        ints[i] = (int) i;
+        ullist__append(other, (void *) &ints[i]);
+    }
+    ullist__delete(true, other, filter_int);
+    cr_assert(ullist__get_length(other) == n / 3, "Expected %zu items to remain.\n", n / 3);
+    for (size_t i = 0; i < n; i += 3) {
+        cr_assert(ullist__pop_front(other) == &ints[i], "Expected item %zu to remain.\n", i);
+    }
+    ullist__destroy(&other);
+}
+
+Test(ullist__delete, local_many_chunks, .init = setup, .fini = teardown) {
+    int ints[6 * ULLIST_CHUNK_CAPACITY];
+    constexpr size_t n = sizeof(ints) / sizeof(ints[0]);
+    UnrolledList * other = ullist__create();
+    for (size_t i = 0; i < n; i++) {
+        ints[i] = 3 * (int) i;
+    }
+    ints[n - 2] = 1;
+    for (size_t i = 0; i < n; i++) {
+        ullist__append(other, (void *) &ints[i]);
+    }
+    ullist__delete(false, other, filter_int);
+    cr_assert(ullist__get_length(other) == n - 1, "Expected %zu items to remain.\n", n - 1);
+    cr_assert(ullist__pop_back(other) == &ints[n - 1], "Expected the last item to remain.\n");
+    cr_assert(ullist__pop_back(other) == &ints[n - 3], "Expected the item before the deleted one to remain.\n");
+    ullist__destroy(&other);
+}
@@ -0,0 +1,8 @@
+#include "llist/ullist.h"
+#include <criterion/criterion.h>
+
+Test(ullist__destroy, noop) {
+    UnrolledList * lst = ullist__create();
+    ullist__destroy(&lst);
+    cr_assert(lst == NULL, "Instance of UnrolledList should be NULL after it has been destroyed.\n");
+}
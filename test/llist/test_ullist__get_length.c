@@ -0,0 +1,49 @@
+#include "llist/ullist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static UnrolledList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ullist__create();
+}
+
+static void teardown (void) {
+    ullist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(ullist__get_length, noop, .init = setup, .fini = teardown) {
+    size_t expected = 0;
+    size_t actual = ullist__get_length(lst);
+    cr_assert(actual == expected, "Instance of UnrolledList should be of length %zu but was %zu.\n", expected, actual);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[]\n");
+}
+
+Test(ullist__get_length, after_inserting_four_items, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    ullist__insert(0, (void *) &arr[3], lst);
+    ullist__insert(0, (void *) &arr[2], lst);
+    ullist__insert(0, (void *) &arr[1], lst);
+    ullist__insert(0, (void *) &arr[0], lst);
+    constexpr size_t expected = sizeof(arr) / sizeof(arr[0]);
+    size_t actual = ullist__get_length(lst);
+    cr_assert(actual == expected, "Instance of UnrolledList should be of length %zu but was %zu.\n", expected, actual);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
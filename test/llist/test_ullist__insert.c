@@ -0,0 +1,57 @@
+#include "llist/ullist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+static UnrolledList * lst = NULL;
+
+typedef llist__Printers Printers;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ullist__create();
+}
+
+static void teardown (void) {
+    ullist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(ullist__insert, four_items_out_of_order, .init = setup, .fini = teardown) {
+    int arr[] = { 100, 101, 102, 103 };
+    ullist__insert(0, (void *) &arr[2], lst);
+    ullist__insert(0, (void *) &arr[0], lst);
+    ullist__insert(2, (void *) &arr[3], lst);
+    ullist__insert(1, (void *) &arr[1], lst);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101, 102, 103]\n");
+}
+
+Test(ullist__insert, splits_full_chunks, .init = setup, .fini = teardown) {
+    // mirror every insertion in a plain array and compare afterwards
+    int arr[5 * ULLIST_CHUNK_CAPACITY];
+    int * expected[5 * ULLIST_CHUNK_CAPACITY];
+    constexpr size_t n = sizeof(arr) / sizeof(arr[0]);
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int) i;
+        size_t pos = (i * 7) % (i + 1);
+        for (size_t j = i; j > pos; j--) {
+            expected[j] = expected[j - 1];
+        }
+        expected[pos] = &arr[i];
+        ullist__insert(pos, (void *) &arr[i], lst);
+    }
+    cr_assert(ullist__get_length(lst) == n, "Expected %zu items.\n", n);
+    for (size_t i = 0; i < n; i++) {
+        cr_assert(ullist__pop_front(lst) == expected[i], "Expected item %zu to be in its inserted position.\n", i);
+    }
+}
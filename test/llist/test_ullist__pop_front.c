@@ -0,0 +1,53 @@
+#include "llist/ullist.h"
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+
+typedef llist__Printers Printers;
+
+static int arr[] = { 100, 101, 102, 103 };
+
+static UnrolledList * lst = NULL;
+
+static void setup (void) {
+    cr_redirect_stdout();
+    lst = ullist__create();
+    ullist__append(lst, (void *) &arr[0]);
+    ullist__append(lst, (void *) &arr[1]);
+    ullist__append(lst, (void *) &arr[2]);
+    ullist__append(lst, (void *) &arr[3]);
+}
+
+static void teardown (void) {
+    ullist__destroy(&lst);
+}
+
+static void print_elem (FILE * fd, size_t idx, size_t nelems, void * elem) {
+    if (idx < nelems - 1) {
+        fprintf(fd, "%d, ", *((int *) elem));
+    } else {
+        fprintf(fd, "%d", *((int *) elem));
+    }
+}
+
+static Printers printers = { .pre = NULL, .elem = print_elem, .post = NULL };
+
+Test(ullist__pop_front, one_item, .init = setup, .fini = teardown) {
+    int * actual = ullist__pop_front(lst);
+    cr_assert(actual == &arr[0], "Expected the first item to be returned.\n");
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[101, 102, 103]\n");
+}
+
+Test(ullist__pop_front, all_items_then_append, .init = setup, .fini = teardown) {
+    ullist__pop_front(lst);
+    ullist__pop_front(lst);
+    ullist__pop_front(lst);
+    ullist__pop_front(lst);
+    cr_assert(ullist__get_length(lst) == 0, "Expected the list to be empty after popping all items.\n");
+    ullist__append(lst, (void *) &arr[1]);
+    ullist__prepend(lst, (void *) &arr[0]);
+    ullist__print(lst, &printers, stdout);
+    fflush(stdout);
+    cr_assert_stdout_eq_str("[100, 101]\n");
+}